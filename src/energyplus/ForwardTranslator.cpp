@@ -57,6 +57,7 @@
 #include "../utilities/idf/WorkspaceObjectOrder.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/ASCIIStrings.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/time/Time.hpp"
@@ -79,9 +80,15 @@
 #include "../utilities/core/Deprecated.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <future>
 #include <iterator>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
 
 using namespace openstudio::model;
 
@@ -91,7 +98,82 @@ namespace openstudio {
 
 namespace energyplus {
 
-  ForwardTranslator::ForwardTranslator() : m_progressBar(nullptr) {
+  namespace {
+
+    // thrown on a worker translator of translateConcurrently when the object needs an object the worker may not translate
+    struct ConcurrentTranslationAborted
+    {
+    };
+
+    // IddObject::hasNameField caches its result in the IddObject, which is shared by all the objects of its type
+    void cacheIddObjectNameFields() {
+      static std::once_flag once;
+      std::call_once(once, [] {
+        for (IddFileType iddFileType : {IddFileType::OpenStudio, IddFileType::EnergyPlus}) {
+          for (const IddObject& iddObject : IddFactory::instance().getObjects(iddFileType)) {
+            iddObject.hasNameField();
+          }
+        }
+      });
+    }
+
+    // fields of modelObject, of its children and of the objects they point to, transitively, which is all the translation of
+    // an object accepted by isTranslatedConcurrently depends on, besides the options. Pointers are listed as handles.
+    std::string translationContent(const ModelObject& modelObject) {
+      std::string result;
+      std::set<Handle> visited;
+      std::vector<WorkspaceObject> objects{modelObject};
+      while (!objects.empty()) {
+        WorkspaceObject object = objects.back();
+        objects.pop_back();
+        if (!visited.insert(object.handle()).second) {
+          continue;
+        }
+
+        result += std::to_string(object.iddObject().type().value());
+        for (unsigned i = 0, n = object.numFields(); i < n; ++i) {
+          // unit separator, which fields do not contain
+          result += '\x1f';
+          if (boost::optional<std::string> field = object.getField(i)) {
+            result += *field;
+          }
+        }
+        result += '\n';
+
+        std::vector<WorkspaceObject> targets = object.targets();
+        objects.insert(objects.end(), targets.rbegin(), targets.rend());
+        if (auto parentObject = object.optionalCast<ParentObject>()) {
+          std::vector<ModelObject> children = parentObject->children();
+          objects.insert(objects.end(), children.rbegin(), children.rend());
+        }
+      }
+      return result;
+    }
+
+    // appends copies of idfObjects to idfObjectsCopy, and translations to translationsCopy with the copies in place of the
+    // objects, so that the objects and their copies may be edited separately
+    void copyTranslation(const std::vector<IdfObject>& idfObjects, const std::vector<std::pair<Handle, IdfObject>>& translations,
+                         std::vector<IdfObject>& idfObjectsCopy, std::vector<std::pair<Handle, IdfObject>>& translationsCopy) {
+      std::map<Handle, IdfObject> copies;
+      for (const IdfObject& idfObject : idfObjects) {
+        idfObjectsCopy.push_back(idfObject.clone(true));
+        copies.emplace(idfObject.handle(), idfObjectsCopy.back());
+      }
+      for (const auto& translation : translations) {
+        auto it = copies.find(translation.second.handle());
+        translationsCopy.emplace_back(translation.first, (it != copies.end()) ? it->second : translation.second.clone(true));
+      }
+    }
+
+  }  // namespace
+
+  ForwardTranslator::ForwardTranslator()
+    : m_progressBar(nullptr),
+      m_numberOfThreads(1),
+      m_mainTranslations(nullptr),
+      m_concurrentTranslationAborted(false),
+      m_translationCacheEnabled(false),
+      m_numberOfCachedTranslations(0) {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ForwardTranslator"));
     m_logSink.setThreadId(std::this_thread::get_id());
@@ -121,6 +203,38 @@ namespace energyplus {
     return translateModelPrivate(modelCopy, true);
   }
 
+  bool ForwardTranslator::translateModelToIdf(const Model& model, std::ostream& os, ProgressBar* progressBar) {
+    auto modelCopy = model.clone(true).cast<Model>();
+
+    m_progressBar = progressBar;
+    if (m_progressBar) {
+      m_progressBar->setMinimum(0);
+      m_progressBar->setMaximum(model.numObjects());
+    }
+
+    translateModelToIdfObjects(modelCopy, true);
+
+    if (!resolveIdfObjectReferences()) {
+      // the Workspace would rename or name some objects
+      createWorkspace().toIdfFile().print(os);
+      return os.good();
+    }
+
+    // as printed by IdfFile, with the version object first as in Workspace::toIdfFile
+    os << '\n';
+    for (const IdfObject& idfObject : m_idfObjects) {
+      if (idfObject.iddObject().type() == IddObjectType::Version) {
+        idfObject.print(os);
+      }
+    }
+    for (const IdfObject& idfObject : m_idfObjects) {
+      if (idfObject.iddObject().type() != IddObjectType::Version) {
+        idfObject.print(os);
+      }
+    }
+    return os.good();
+  }
+
   Workspace ForwardTranslator::translateModelObject(ModelObject& modelObject) {
     Model modelCopy;
     modelObject.clone(modelCopy);
@@ -130,8 +244,72 @@ namespace energyplus {
     return translateModelPrivate(modelCopy, false);
   }
 
+  bool ForwardTranslator::resolveIdfObjectReferences() {
+    // index of the object with each name, upper case, in each reference list
+    std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> targets;
+    for (std::size_t i = 0; i < m_idfObjects.size(); ++i) {
+      const IdfObject& idfObject = m_idfObjects[i];
+      if (!idfObject.iddObject().hasNameField()) {
+        continue;
+      }
+      std::string name = idfObject.nameString();
+      if (name.empty()) {
+        if (idfObject.nameString(true).empty()) {
+          // the Workspace creates a name
+          return false;
+        }
+        continue;
+      }
+      name = ascii_to_upper_copy(name);
+      for (const std::string& reference : idfObject.iddObject().references()) {
+        if (!targets[reference].emplace(name, i).second) {
+          // the Workspace renames one of the objects
+          return false;
+        }
+      }
+    }
+
+    for (IdfObject& idfObject : m_idfObjects) {
+      for (unsigned index : idfObject.objectListFields()) {
+        std::string targetName = idfObject.getString(index).get();
+        if (targetName.empty()) {
+          continue;
+        }
+
+        boost::optional<std::size_t> target;
+        const std::string upperTargetName = ascii_to_upper_copy(targetName);
+        for (const std::string& objectList : idfObject.iddObject().objectLists(index)) {
+          auto it = targets.find(objectList);
+          if (it != targets.end()) {
+            auto targetIt = it->second.find(upperTargetName);
+            if (targetIt != it->second.end()) {
+              target = targetIt->second;
+              break;
+            }
+          }
+        }
+
+        // as Workspace::addObjects, point to the target's name or clear the field
+        if (target) {
+          std::string name = m_idfObjects[*target].nameString();
+          if (name != targetName) {
+            idfObject.setString(index, name);
+          }
+        } else {
+          LOG_FREE(Warn, "openstudio.Workspace",
+                   idfObject.briefDescription() << ", points to an object named " << targetName << " from field " << index
+                                                << ", but that object cannot be located.");
+          idfObject.setString(index, "");
+        }
+      }
+    }
+
+    return true;
+  }
+
   std::vector<LogMessage> ForwardTranslator::warnings() const {
     std::vector<LogMessage> allMessages = m_logSink.logMessages();
+    allMessages.insert(allMessages.end(), m_concurrentLogMessages.cbegin(), m_concurrentLogMessages.cend());
     std::vector<LogMessage> result;
     std::copy_if(allMessages.cbegin(), allMessages.cend(), std::back_inserter(result),
                  [](const auto& logMessage) { return logMessage.logLevel() == Warn; });
@@ -140,6 +318,7 @@ namespace energyplus {
 
   std::vector<LogMessage> ForwardTranslator::errors() const {
     std::vector<LogMessage> allMessages = m_logSink.logMessages();
+    allMessages.insert(allMessages.end(), m_concurrentLogMessages.cbegin(), m_concurrentLogMessages.cend());
     std::vector<LogMessage> result;
     std::copy_if(allMessages.cbegin(), allMessages.cend(), std::back_inserter(result),
                  [](const auto& logMessage) { return logMessage.logLevel() > Warn; });
@@ -174,6 +353,34 @@ namespace energyplus {
     m_forwardTranslatorOptions.setExcludeSpaceTranslation(excludeSpaceTranslation);
   }
 
+  void ForwardTranslator::setNumberOfThreads(unsigned numberOfThreads) {
+    m_numberOfThreads = numberOfThreads;
+  }
+
+  unsigned ForwardTranslator::numberOfThreads() const {
+    return m_numberOfThreads;
+  }
+
+  void ForwardTranslator::setTranslationCacheEnabled(bool translationCacheEnabled) {
+    m_translationCacheEnabled = translationCacheEnabled;
+    if (!m_translationCacheEnabled) {
+      clearTranslationCache();
+    }
+  }
+
+  bool ForwardTranslator::translationCacheEnabled() const {
+    return m_translationCacheEnabled;
+  }
+
+  void ForwardTranslator::clearTranslationCache() {
+    m_translationCache.clear();
+    m_translationCacheOptions.clear();
+  }
+
+  unsigned ForwardTranslator::numberOfCachedTranslations() const {
+    return m_numberOfCachedTranslations;
+  }
+
   // Figure out which object
   // * If the load is assigned to a space,
   //     * m_forwardTranslatorOptions.excludeSpaceTranslation() = true: translate and return the IdfObject for the Zone
@@ -207,6 +414,11 @@ namespace energyplus {
   };
 
   Workspace ForwardTranslator::translateModelPrivate(model::Model& model, bool fullModelTranslation) {
+    translateModelToIdfObjects(model, fullModelTranslation);
+    return createWorkspace();
+  }
+
+  void ForwardTranslator::translateModelToIdfObjects(model::Model& model, bool fullModelTranslation) {
     reset();
 
     // translate Version first
@@ -595,23 +807,15 @@ namespace energyplus {
     translateAirflowNetwork(model);
 
     // now loop over all objects
-    for (const IddObjectType& iddObjectType : iddObjectsToTranslate()) {
-
-      // get objects by type in sorted order
-      std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
-      std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
-
-      for (const WorkspaceObject& workspaceObject : objects) {
-        auto modelObject = workspaceObject.cast<ModelObject>();
-        translateAndMapModelObject(modelObject);
-      }
-    }
+    translateObjectsByType(model, iddObjectsToTranslate());
 
     if (fullModelTranslation) {
       // add output requests
       this->createStandardOutputRequests(model);
     }
+  }
 
+  Workspace ForwardTranslator::createWorkspace() {
     Workspace workspace(StrictnessLevel::Minimal, IddFileType::EnergyPlus);
     OptionalWorkspaceObject vo = workspace.versionObject();
     OS_ASSERT(vo);
@@ -667,6 +871,23 @@ namespace energyplus {
       return boost::optional<IdfObject>(objInMapIt->second);
     }
 
+    if (m_mainTranslations) {
+      // worker translator of translateConcurrently
+      auto objInMainMapIt = m_mainTranslations->find(modelObject.handle());
+      if (objInMainMapIt != m_mainTranslations->end()) {
+        return boost::optional<IdfObject>(objInMainMapIt->second);
+      }
+
+      // other objects may be shared with objects translated on other threads, the main translator will translate it
+      if (modelObject.handle() != *m_concurrentTranslationRoot) {
+        OptionalParentObject parent = modelObject.parent();
+        if (!parent || (parent->handle() != *m_concurrentTranslationRoot)) {
+          m_concurrentTranslationAborted = true;
+          throw ConcurrentTranslationAborted();
+        }
+      }
+    }
+
     LOG(Trace, "Translating " << modelObject.briefDescription() << ".");
 
     switch (modelObject.iddObject().type().value()) {
@@ -3693,29 +3914,279 @@ namespace energyplus {
       // IddObjectType::OS_SurfaceProperty_ConvectionCoefficients,              // Surface, SubSurface, or InternalMass
     };
 
+    for (const ModelObject& modelObject : translateObjectsByType(model, iddObjectTypes)) {
+      if (auto constructionBase_ = modelObject.optionalCast<ConstructionBase>()) {
+        if (istringEqual("Interior Partition Surface Construction", modelObject.name().get())) {
+          m_interiorPartitionSurfaceConstruction = constructionBase_.get();
+        }
+
+        if (istringEqual("Shading Surface Construction", modelObject.name().get())) {
+          m_exteriorSurfaceConstruction = constructionBase_.get();
+        }
+      }
+    }
+  }
+
+  std::vector<ModelObject> ForwardTranslator::translateObjectsByType(const model::Model& model, const std::vector<IddObjectType>& iddObjectTypes) {
+    std::vector<ModelObject> result;
+
+    // objects of consecutive types that are translated concurrently, not translated yet
+    std::vector<ModelObject> pending;
+    auto translatePending = [this, &pending]() {
+      translateConcurrently(pending);
+      pending.clear();
+    };
+
     for (const IddObjectType& iddObjectType : iddObjectTypes) {
 
       // get objects by type in sorted order
       std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
       std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
 
+      const bool concurrent = ((m_numberOfThreads != 1) || m_translationCacheEnabled) && isTranslatedConcurrently(iddObjectType);
+      if (!concurrent) {
+        translatePending();
+      }
+
       for (const WorkspaceObject& workspaceObject : objects) {
         auto modelObject = workspaceObject.cast<ModelObject>();
-        boost::optional<IdfObject> result = translateAndMapModelObject(modelObject);
+        if (concurrent) {
+          pending.push_back(modelObject);
+        } else {
+          translateAndMapModelObject(modelObject);
+        }
+        result.push_back(modelObject);
+      }
+    }
+    translatePending();
+
+    return result;
+  }
 
-        if (auto constructionBase_ = modelObject.optionalCast<ConstructionBase>()) {
-          if (istringEqual("Interior Partition Surface Construction", workspaceObject.name().get())) {
-            m_interiorPartitionSurfaceConstruction = constructionBase_.get();
+  void ForwardTranslator::translateConcurrently(std::vector<ModelObject>& modelObjects) {
+    unsigned numberOfThreads = m_numberOfThreads;
+    if (numberOfThreads == 0) {
+      numberOfThreads = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    if (m_translationCacheEnabled) {
+      const std::string options = m_forwardTranslatorOptions.string();
+      if (options != m_translationCacheOptions) {
+        m_translationCache.clear();
+        m_translationCacheOptions = options;
+      }
+    }
+
+    // indices of the objects the workers translate, or that are taken from the translation cache
+    std::vector<std::size_t> concurrentIndices;
+    if ((numberOfThreads > 1) || m_translationCacheEnabled) {
+      for (std::size_t i = 0; i < modelObjects.size(); ++i) {
+        const ModelObject& modelObject = modelObjects[i];
+        // LifeCycleCosts are translated with the model's LifeCycleCostParameters, which they may create
+        if (isTranslatedConcurrently(modelObject.iddObject().type()) && (m_map.find(modelObject.handle()) == m_map.end())
+            && modelObject.lifeCycleCosts().empty()) {
+          concurrentIndices.push_back(i);
+        }
+      }
+    }
+
+    // positions in concurrentIndices of the objects the workers translate, the others have an up to date cached translation
+    std::vector<std::size_t> translatedIndices;
+    std::vector<std::string> contents(concurrentIndices.size());
+    std::vector<const CachedTranslation*> cachedTranslations(concurrentIndices.size(), nullptr);
+    for (std::size_t c = 0; c < concurrentIndices.size(); ++c) {
+      if (m_translationCacheEnabled) {
+        const ModelObject& modelObject = modelObjects[concurrentIndices[c]];
+        contents[c] = translationContent(modelObject);
+        auto it = m_translationCache.find(modelObject.handle());
+        if ((it != m_translationCache.end()) && (it->second.content == contents[c])) {
+          cachedTranslations[c] = &it->second;
+          continue;
+        }
+      }
+      translatedIndices.push_back(c);
+    }
+
+    // a few objects per chunk so that the workers stay busy until the end
+    const std::size_t chunkSize = std::max<std::size_t>(8, translatedIndices.size() / (4 * numberOfThreads));
+    const std::size_t numberOfChunks = (translatedIndices.size() + chunkSize - 1) / chunkSize;
+    if (!m_translationCacheEnabled && (numberOfChunks < 2)) {
+      for (ModelObject& modelObject : modelObjects) {
+        translateAndMapModelObject(modelObject);
+      }
+      return;
+    }
+    // with the cache, there may be a single worker, which isolates the translations of the objects from each other, or none
+    numberOfThreads = static_cast<unsigned>(std::min<std::size_t>(numberOfThreads, numberOfChunks));
+
+    cacheIddObjectNameFields();
+
+    struct ConcurrentTranslation
+    {
+      std::size_t worker = 0;
+      // objects the worker added to its m_idfObjects
+      std::size_t begin = 0;
+      std::size_t end = 0;
+      bool aborted = true;
+      std::vector<std::pair<Handle, IdfObject>> translations;
+      std::vector<LogMessage> logMessages;
+    };
+    std::vector<ConcurrentTranslation> concurrentTranslations(concurrentIndices.size());
+
+    std::vector<std::unique_ptr<ForwardTranslator>> workers;
+    for (unsigned i = 0; i < numberOfThreads; ++i) {
+      workers.push_back(std::make_unique<ForwardTranslator>());
+      workers.back()->m_forwardTranslatorOptions = m_forwardTranslatorOptions;
+      workers.back()->m_mainTranslations = &m_map;
+    }
+
+    std::atomic<std::size_t> nextChunk(0);
+    auto translateChunks = [&](std::size_t workerIndex) {
+      ForwardTranslator& worker = *workers[workerIndex];
+      // the worker's log sink only keeps the messages of this thread
+      worker.reset();
+      for (std::size_t chunk = nextChunk++; chunk < numberOfChunks; chunk = nextChunk++) {
+        const std::size_t end = std::min(translatedIndices.size(), (chunk + 1) * chunkSize);
+        for (std::size_t t = chunk * chunkSize; t < end; ++t) {
+          const std::size_t c = translatedIndices[t];
+          ModelObject& modelObject = modelObjects[concurrentIndices[c]];
+          ConcurrentTranslation& concurrentTranslation = concurrentTranslations[c];
+          concurrentTranslation.worker = workerIndex;
+          concurrentTranslation.begin = worker.m_idfObjects.size();
+
+          worker.m_map.clear();
+          worker.m_concurrentTranslationRoot = modelObject.handle();
+          worker.m_concurrentTranslationAborted = false;
+          try {
+            worker.translateAndMapModelObject(modelObject);
+          } catch (const ConcurrentTranslationAborted&) {
+          }
+
+          if (worker.m_concurrentTranslationAborted) {
+            worker.m_idfObjects.erase(worker.m_idfObjects.begin() + concurrentTranslation.begin, worker.m_idfObjects.end());
+          } else {
+            concurrentTranslation.aborted = false;
+            concurrentTranslation.end = worker.m_idfObjects.size();
+            concurrentTranslation.translations.assign(worker.m_map.begin(), worker.m_map.end());
+            concurrentTranslation.logMessages = worker.m_logSink.logMessages();
+          }
+          worker.m_logSink.resetStringStream();
+        }
+      }
+    };
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < numberOfThreads; ++i) {
+      futures.push_back(std::async(std::launch::async, translateChunks, i));
+    }
+    if (numberOfThreads > 0) {
+      translateChunks(0);
+    }
+    for (auto& future : futures) {
+      future.get();
+    }
+
+    // merge in the order of modelObjects, the main translator translates the objects the workers could not, or that were
+    // translated in the meantime by an object before them
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < modelObjects.size(); ++i) {
+      ModelObject& modelObject = modelObjects[i];
+      if ((c < concurrentIndices.size()) && (concurrentIndices[c] == i)) {
+        const CachedTranslation* cachedTranslation = cachedTranslations[c];
+        const ConcurrentTranslation& concurrentTranslation = concurrentTranslations[c];
+        const std::vector<std::pair<Handle, IdfObject>>& translations =
+          cachedTranslation ? cachedTranslation->translations : concurrentTranslation.translations;
+        const bool merge = (cachedTranslation || !concurrentTranslation.aborted) && (m_map.find(modelObject.handle()) == m_map.end())
+                           && std::none_of(translations.cbegin(), translations.cend(),
+                                           [this](const auto& translation) { return m_map.find(translation.first) != m_map.end(); });
+        if (merge) {
+          std::vector<IdfObject> idfObjects;
+          std::vector<std::pair<Handle, IdfObject>> mergedTranslations;
+          const std::vector<LogMessage>& logMessages = cachedTranslation ? cachedTranslation->logMessages : concurrentTranslation.logMessages;
+          if (cachedTranslation) {
+            // copies, the translators of other objects may edit the translations
+            copyTranslation(cachedTranslation->idfObjects, cachedTranslation->translations, idfObjects, mergedTranslations);
+            ++m_numberOfCachedTranslations;
+          } else {
+            const std::vector<IdfObject>& workerIdfObjects = workers[concurrentTranslation.worker]->m_idfObjects;
+            idfObjects.assign(workerIdfObjects.begin() + concurrentTranslation.begin, workerIdfObjects.begin() + concurrentTranslation.end);
+            mergedTranslations = concurrentTranslation.translations;
+            if (m_translationCacheEnabled) {
+              CachedTranslation& newCachedTranslation = m_translationCache[modelObject.handle()];
+              newCachedTranslation = CachedTranslation();
+              newCachedTranslation.content = std::move(contents[c]);
+              copyTranslation(idfObjects, mergedTranslations, newCachedTranslation.idfObjects, newCachedTranslation.translations);
+              newCachedTranslation.logMessages = logMessages;
+            }
           }
+          ++c;
 
-          if (istringEqual("Shading Surface Construction", workspaceObject.name().get())) {
-            m_exteriorSurfaceConstruction = constructionBase_.get();
+          m_idfObjects.insert(m_idfObjects.end(), idfObjects.begin(), idfObjects.end());
+          m_map.insert(mergedTranslations.cbegin(), mergedTranslations.cend());
+          m_concurrentLogMessages.insert(m_concurrentLogMessages.end(), logMessages.cbegin(), logMessages.cend());
+
+          if (m_progressBar && !mergedTranslations.empty()) {
+            m_progressBar->setValue((int)m_map.size());
           }
+          continue;
         }
+        ++c;
       }
+      translateAndMapModelObject(modelObject);
     }
   }
 
+  bool ForwardTranslator::isTranslatedConcurrently(const IddObjectType& iddObjectType) {
+    // Thermochromic glazings translate the glazings they group and table lookups their independent variables, which other
+    // objects may share; schedules and space loads share schedule type limits and definitions.
+    static const std::set<IddObjectType> iddObjectTypes{
+      IddObjectType::OS_MaterialProperty_GlazingSpectralData,
+      IddObjectType::OS_Material,
+      IddObjectType::OS_Material_AirGap,
+      IddObjectType::OS_Material_InfraredTransparent,
+      IddObjectType::OS_Material_NoMass,
+      IddObjectType::OS_Material_RoofVegetation,
+
+      IddObjectType::OS_WindowMaterial_Blind,
+      IddObjectType::OS_WindowMaterial_DaylightRedirectionDevice,
+      IddObjectType::OS_WindowMaterial_Gas,
+      IddObjectType::OS_WindowMaterial_GasMixture,
+      IddObjectType::OS_WindowMaterial_Glazing,
+      IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod,
+      IddObjectType::OS_WindowMaterial_Screen,
+      IddObjectType::OS_WindowMaterial_Shade,
+      IddObjectType::OS_WindowMaterial_SimpleGlazingSystem,
+      IddObjectType::OS_WindowProperty_FrameAndDivider,
+
+      IddObjectType::OS_Construction,
+      IddObjectType::OS_Construction_CfactorUndergroundWall,
+      IddObjectType::OS_Construction_FfactorGroundFloor,
+      IddObjectType::OS_Construction_InternalSource,
+
+      IddObjectType::OS_Curve_Bicubic,
+      IddObjectType::OS_Curve_Biquadratic,
+      IddObjectType::OS_Curve_Cubic,
+      IddObjectType::OS_Curve_DoubleExponentialDecay,
+      IddObjectType::OS_Curve_Exponent,
+      IddObjectType::OS_Curve_ExponentialDecay,
+      IddObjectType::OS_Curve_ExponentialSkewNormal,
+      IddObjectType::OS_Curve_FanPressureRise,
+      IddObjectType::OS_Curve_Functional_PressureDrop,
+      IddObjectType::OS_Curve_Linear,
+      IddObjectType::OS_Curve_QuadLinear,
+      IddObjectType::OS_Curve_QuintLinear,
+      IddObjectType::OS_Curve_Quadratic,
+      IddObjectType::OS_Curve_QuadraticLinear,
+      IddObjectType::OS_Curve_Quartic,
+      IddObjectType::OS_Curve_RectangularHyperbola1,
+      IddObjectType::OS_Curve_RectangularHyperbola2,
+      IddObjectType::OS_Curve_Sigmoid,
+      IddObjectType::OS_Curve_Triquadratic,
+      IddObjectType::OS_Table_MultiVariableLookup,
+    };
+    return iddObjectTypes.find(iddObjectType) != iddObjectTypes.end();
+  }
+
   void ForwardTranslator::translateSchedules(const model::Model& model) {
 
     // Make sure these get in the idf file
@@ -4044,6 +4515,10 @@ namespace energyplus {
 
     m_constructionHandleToReversedConstructions.clear();
 
+    m_concurrentLogMessages.clear();
+
+    m_numberOfCachedTranslations = 0;
+
     m_logSink.setThreadId(std::this_thread::get_id());
 
     m_logSink.resetStringStream();
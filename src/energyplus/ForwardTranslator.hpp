@@ -526,6 +526,12 @@ namespace energyplus {
    */
     Workspace translateModel(const model::Model& model, ProgressBar* progressBar = nullptr);
 
+    /** Translates the given Model and writes it to os in IDF format, as translateModel(model).toIdfFile().print(os) would, but
+   *  without building the Workspace: the translated objects are written in order, with their references resolved by name in
+   *  a single pass. Returns false if os could not be written.
+   */
+    bool translateModelToIdf(const model::Model& model, std::ostream& os, ProgressBar* progressBar = nullptr);
+
     /** Translates a ModelObject into a Workspace
    */
     Workspace translateModelObject(model::ModelObject& modelObject);
@@ -578,6 +584,36 @@ namespace energyplus {
     void setExcludeSpaceTranslation(bool excludeSpaceTranslation);
 
     //@}
+    /** @name Concurrent translation */
+    //@{
+
+    /** Sets the number of threads used to translate objects that only depend on objects translated before them, such as
+   *  materials, layered constructions and curves. The default, 1, translates everything on the calling thread, 0 uses
+   *  std::thread::hardware_concurrency() threads. The translated Workspace does not depend on the number of threads;
+   *  the warnings and errors of the objects translated on other threads are listed after the others. */
+    void setNumberOfThreads(unsigned numberOfThreads);
+
+    unsigned numberOfThreads() const;
+
+    //@}
+    /** @name Translation cache */
+    //@{
+
+    /** Enables a cache of the translations of the objects that may be translated on other threads (see setNumberOfThreads),
+   *  for translating the same Model again after a few changes. The translation of each object is kept along with the fields
+   *  of the object, of its children and of the objects they point to; when the object is translated again with the same
+   *  fields and options, the cached IdfObjects are used instead of translating it. The translated Workspace does not depend
+   *  on the cache. Disabled by default, disabling it clears it. */
+    void setTranslationCacheEnabled(bool translationCacheEnabled);
+
+    bool translationCacheEnabled() const;
+
+    void clearTranslationCache();
+
+    /// Number of objects whose cached translation was used by the last translation.
+    unsigned numberOfCachedTranslations() const;
+
+    //@}
 
    private:
     REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
@@ -599,6 +635,16 @@ namespace energyplus {
    */
     Workspace translateModelPrivate(model::Model& model, bool fullModelTranslation);
 
+    // translates the model to m_idfObjects, see translateModelPrivate
+    void translateModelToIdfObjects(model::Model& model, bool fullModelTranslation);
+
+    // adds m_idfObjects to a new EnergyPlus Workspace
+    Workspace createWorkspace();
+
+    // resolves the reference fields of m_idfObjects by name as Workspace::addObjects does. Returns false, without changing
+    // m_idfObjects, if adding them to a Workspace would rename some objects or name unnamed ones
+    bool resolveIdfObjectReferences();
+
     // Pick up the Zone, ZoneList, Space or SpaceList (if allowSpaceType is true) object for a given SpaceLoad (or SpaceLoadInstance)
     IdfObject getSpaceLoadParent(const model::SpaceLoad& sp, bool allowSpaceType = true);
 
@@ -1630,6 +1676,18 @@ namespace energyplus {
     // translate all constructions
     void translateConstructions(const model::Model& model);
 
+    // translates the objects of each type, sorted by name, as translateAndMapModelObject would, and returns them in that order.
+    // With several threads or the translation cache, the objects of consecutive types accepted by isTranslatedConcurrently are
+    // translated together
+    std::vector<model::ModelObject> translateObjectsByType(const model::Model& model, const std::vector<IddObjectType>& iddObjectTypes);
+
+    // translates modelObjects in order, those accepted by isTranslatedConcurrently on worker translators or from the
+    // translation cache
+    void translateConcurrently(std::vector<model::ModelObject>& modelObjects);
+
+    // types whose translators only read the object, the children it is the parent of, and objects translated before it
+    static bool isTranslatedConcurrently(const IddObjectType& iddObjectType);
+
     // translate all schedules and find always on and always off schedules if they exist
     void translateSchedules(const model::Model& model);
 
@@ -1728,6 +1786,32 @@ namespace energyplus {
 
     // ForwardTranslator options
     ForwardTranslatorOptions m_forwardTranslatorOptions;
+
+    unsigned m_numberOfThreads;
+
+    // set on the worker translators of translateConcurrently: translations of the main translator, which do not change while
+    // the workers run, the object being translated, and whether it needed an object the worker may not translate
+    const ModelObjectMap* m_mainTranslations;
+    boost::optional<Handle> m_concurrentTranslationRoot;
+    bool m_concurrentTranslationAborted;
+
+    // warnings and errors logged by the worker translators for the objects they translated
+    std::vector<LogMessage> m_concurrentLogMessages;
+
+    struct CachedTranslation
+    {
+      // fields of the object, its children and the objects they point to when it was translated
+      std::string content;
+      std::vector<IdfObject> idfObjects;
+      std::vector<std::pair<Handle, IdfObject>> translations;
+      std::vector<LogMessage> logMessages;
+    };
+
+    bool m_translationCacheEnabled;
+    // by handle of the translated object, for the options in m_translationCacheOptions
+    std::map<Handle, CachedTranslation> m_translationCache;
+    std::string m_translationCacheOptions;
+    unsigned m_numberOfCachedTranslations;
   };
 
 }  // namespace energyplus
@@ -986,3 +986,130 @@ TEST_F(EnergyPlusFixture, NoUselessWarnings) {
                  [](const auto& logMessage) { return logMessage.logMessage(); });
   EXPECT_EQ(0, logMessages.size()) << fmt::format("Expected no messages logged, got: {}", logStrings);
 }
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_NumberOfThreads) {
+  Model model = exampleModel();
+
+  // enough materials, constructions and curves for the workers, some materials are shared between constructions
+  std::vector<OpaqueMaterial> sharedMaterials;
+  for (int i = 0; i < 10; ++i) {
+    StandardOpaqueMaterial material(model, "MediumSmooth", 0.01 * (i + 1));
+    material.setName("Shared Material " + std::to_string(i));
+    sharedMaterials.push_back(material);
+  }
+  for (int i = 0; i < 100; ++i) {
+    StandardOpaqueMaterial material(model, "Rough", 0.1, 0.5 + 0.01 * i);
+    material.setName("Material " + std::to_string(i));
+    Construction construction(std::vector<OpaqueMaterial>{sharedMaterials[i % 10], material});
+    construction.setName("Construction " + std::to_string(i));
+
+    CurveBiquadratic curve(model);
+    curve.setName("Curve " + std::to_string(i));
+    curve.setCoefficient1Constant(i);
+  }
+
+  ForwardTranslator forwardTranslator;
+  EXPECT_EQ(1u, forwardTranslator.numberOfThreads());
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::stringstream ss;
+  workspace.toIdfFile().print(ss);
+  std::vector<LogMessage> warnings = forwardTranslator.warnings();
+
+  for (unsigned numberOfThreads : {2u, 4u, 0u}) {
+    forwardTranslator.setNumberOfThreads(numberOfThreads);
+    EXPECT_EQ(numberOfThreads, forwardTranslator.numberOfThreads());
+    Workspace concurrentWorkspace = forwardTranslator.translateModel(model);
+    EXPECT_EQ(workspace.numObjects(), concurrentWorkspace.numObjects());
+    std::stringstream concurrentSs;
+    concurrentWorkspace.toIdfFile().print(concurrentSs);
+    EXPECT_EQ(ss.str(), concurrentSs.str()) << "numberOfThreads = " << numberOfThreads;
+    EXPECT_EQ(warnings.size(), forwardTranslator.warnings().size());
+    EXPECT_EQ(0u, forwardTranslator.errors().size());
+  }
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslationCache) {
+  Model model = exampleModel();
+
+  std::vector<OpaqueMaterial> sharedMaterials;
+  for (int i = 0; i < 5; ++i) {
+    StandardOpaqueMaterial material(model, "MediumSmooth", 0.01 * (i + 1));
+    material.setName("Shared Material " + std::to_string(i));
+    sharedMaterials.push_back(material);
+  }
+  std::vector<CurveBiquadratic> curves;
+  for (int i = 0; i < 20; ++i) {
+    StandardOpaqueMaterial material(model, "Rough", 0.1, 0.5 + 0.01 * i);
+    material.setName("Material " + std::to_string(i));
+    Construction construction(std::vector<OpaqueMaterial>{sharedMaterials[i % 5], material});
+    construction.setName("Construction " + std::to_string(i));
+
+    CurveBiquadratic curve(model);
+    curve.setName("Curve " + std::to_string(i));
+    curve.setCoefficient1Constant(i);
+    curves.push_back(curve);
+  }
+
+  // the cached translator translates to the same text as a new one each time
+  ForwardTranslator cachedForwardTranslator;
+  EXPECT_FALSE(cachedForwardTranslator.translationCacheEnabled());
+  cachedForwardTranslator.setTranslationCacheEnabled(true);
+  EXPECT_TRUE(cachedForwardTranslator.translationCacheEnabled());
+  auto expectSameTranslation = [&model, &cachedForwardTranslator]() {
+    ForwardTranslator forwardTranslator;
+    forwardTranslator.setForwardTranslatorOptions(cachedForwardTranslator.forwardTranslatorOptions());
+    std::stringstream ss;
+    forwardTranslator.translateModel(model).toIdfFile().print(ss);
+    std::stringstream cachedSs;
+    cachedForwardTranslator.translateModel(model).toIdfFile().print(cachedSs);
+    EXPECT_EQ(ss.str(), cachedSs.str());
+    EXPECT_EQ(forwardTranslator.warnings().size(), cachedForwardTranslator.warnings().size());
+    EXPECT_EQ(0u, cachedForwardTranslator.errors().size());
+  };
+
+  expectSameTranslation();
+  EXPECT_EQ(0u, cachedForwardTranslator.numberOfCachedTranslations());
+  expectSameTranslation();
+  const unsigned numberOfCachedTranslations = cachedForwardTranslator.numberOfCachedTranslations();
+  EXPECT_GE(numberOfCachedTranslations, 65u);
+
+  // editing a material invalidates its translation and the translations of the constructions that have it
+  EXPECT_TRUE(sharedMaterials[0].setThickness(0.2));
+  EXPECT_TRUE(curves[0].setCoefficient2x(2.0));
+  expectSameTranslation();
+  EXPECT_EQ(numberOfCachedTranslations - 6u, cachedForwardTranslator.numberOfCachedTranslations());
+
+  // renaming a material does too
+  sharedMaterials[1].setName("Renamed Shared Material");
+  expectSameTranslation();
+  EXPECT_EQ(numberOfCachedTranslations - 5u, cachedForwardTranslator.numberOfCachedTranslations());
+
+  // translations with other options are not used
+  cachedForwardTranslator.setExcludeLCCObjects(true);
+  expectSameTranslation();
+  EXPECT_EQ(0u, cachedForwardTranslator.numberOfCachedTranslations());
+  expectSameTranslation();
+  EXPECT_EQ(numberOfCachedTranslations, cachedForwardTranslator.numberOfCachedTranslations());
+
+  cachedForwardTranslator.clearTranslationCache();
+  expectSameTranslation();
+  EXPECT_EQ(0u, cachedForwardTranslator.numberOfCachedTranslations());
+
+  cachedForwardTranslator.setTranslationCacheEnabled(false);
+  expectSameTranslation();
+  EXPECT_EQ(0u, cachedForwardTranslator.numberOfCachedTranslations());
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslateModelToIdf) {
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::stringstream ss;
+  workspace.toIdfFile().print(ss);
+
+  std::stringstream streamed;
+  EXPECT_TRUE(forwardTranslator.translateModelToIdf(model, streamed));
+  EXPECT_EQ(ss.str(), streamed.str());
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+}
@@ -8,11 +8,17 @@
 #include "../ForwardTranslator.hpp"
 
 #include "../../model/Model.hpp"
+#include "../../model/Construction.hpp"
+#include "../../model/CurveBiquadratic.hpp"
+#include "../../model/StandardOpaqueMaterial.hpp"
 
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/FileLogSink.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/idf/Workspace.hpp"
 
+#include <sstream>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::energyplus;
@@ -27,6 +33,8 @@ static void BM_FT_ExampleModel_sameFT(benchmark::State& state) {
 
   ForwardTranslator forwardTranslator;
   forwardTranslator.setExcludeSpaceTranslation(state.range(1) == 0 ? false : true);
+  // the third argument enables the translation cache, the model does not change between translations
+  forwardTranslator.setTranslationCacheEnabled(state.range(2) != 0);
 
   // Code inside this loop is measured repeatedly
   for (auto _ : state) {
@@ -58,6 +66,57 @@ static void BM_FT_ExampleModel_newFT(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+static void BM_FT_ExampleModel_toIdf(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+
+  // range(0) == 0: through the Workspace, 1: written directly
+  for (auto _ : state) {
+    std::stringstream ss;
+    if (state.range(0) == 0) {
+      Workspace workspace = forwardTranslator.translateModel(model);
+      workspace.toIdfFile().print(ss);
+    } else {
+      forwardTranslator.translateModelToIdf(model, ss);
+    }
+    benchmark::DoNotOptimize(ss);
+  }
+}
+
+static void BM_FT_Constructions_threads(benchmark::State& state) {
+
+  FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
+  logFile.setLogLevel(Error);
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  // range(0) constructions of three materials, one of them shared, and as many curves
+  Model model = exampleModel();
+  StandardOpaqueMaterial sharedMaterial(model);
+  for (auto i = 0; i < state.range(0); ++i) {
+    StandardOpaqueMaterial outside(model, "Rough", 0.1, 0.5 + 0.001 * i);
+    StandardOpaqueMaterial inside(model, "Smooth", 0.02, 0.16 + 0.001 * i);
+    Construction construction(std::vector<OpaqueMaterial>{outside, sharedMaterial, inside});
+
+    CurveBiquadratic curve(model);
+    curve.setCoefficient1Constant(0.001 * i);
+  }
+
+  ForwardTranslator forwardTranslator;
+  forwardTranslator.setNumberOfThreads(state.range(1));
+
+  for (auto _ : state) {
+    Workspace workspace = forwardTranslator.translateModel(model);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -70,4 +129,9 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 // With Complexity
 BENCHMARK(BM_FT_ExampleModel_newFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
 
-BENCHMARK(BM_FT_ExampleModel_sameFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
+BENCHMARK(BM_FT_ExampleModel_sameFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}, {0, 1}})->Complexity();
+
+// Thread sweep, the second argument is the number of threads
+BENCHMARK(BM_FT_Constructions_threads)->Unit(benchmark::kMillisecond)->ArgsProduct({{256, 2048}, {1, 2, 4, 8}});
+
+BENCHMARK(BM_FT_ExampleModel_toIdf)->Unit(benchmark::kMillisecond)->Arg(0)->Arg(1);
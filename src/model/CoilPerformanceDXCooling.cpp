@@ -492,16 +492,7 @@ namespace model {
 
       const std::string sqlObjectType = "Coil:Cooling:DX:TwoStageWithHumidityControlMode";
 
-      const std::string directQuery = R"sql(
-      SELECT Value FROM ComponentSizes
-        WHERE CompType = ?
-          AND CompName = ?
-          AND Description = ?
-          AND Units = ?;
-    )sql";
-      boost::optional<double> val = model().sqlFile().get().execAndReturnFirstDouble(directQuery,
-                                                                                     // bindArgs
-                                                                                     sqlObjectType, sqlName, valueName, units);
+      boost::optional<double> val = model().sqlFile().get().componentSizeValue(sqlObjectType, sqlName, valueName, units);
       if (!val) {
         LOG(Debug, fmt::format(R"sql(The direct query failed:
 SELECT Value FROM ComponentSizes
@@ -157,7 +157,7 @@ namespace model {
 
       if (!result) {
         LOG(Warn, "Creating GenericModelObject for IddObjectType '" << object.iddObject().type().valueName() << "'.");
-        result = std::shared_ptr<GenericModelObject_Impl>(new GenericModelObject_Impl(object, this, keepHandle));
+        result = openstudio::detail::makeWorkspaceObject<GenericModelObject_Impl>(objectArena(), object, this, keepHandle);
       }
 
       return result;
@@ -173,8 +173,8 @@ namespace model {
       if (!result) {
         LOG(Warn, "Creating GenericModelObject for IddObjectType '" << originalObjectImplPtr->iddObject().type().valueName() << "'.");
         if (dynamic_pointer_cast<GenericModelObject_Impl>(originalObjectImplPtr)) {
-          result = std::shared_ptr<GenericModelObject_Impl>(
-            new GenericModelObject_Impl(*dynamic_pointer_cast<GenericModelObject_Impl>(originalObjectImplPtr), this, keepHandle));
+          result = openstudio::detail::makeWorkspaceObject<GenericModelObject_Impl>(
+            objectArena(), *dynamic_pointer_cast<GenericModelObject_Impl>(originalObjectImplPtr), this, keepHandle);
         } else {
           if (dynamic_pointer_cast<ModelObject_Impl>(originalObjectImplPtr)) {
             std::cout << "Please register copy constructors for IddObjectType '" << originalObjectImplPtr->iddObject().type().valueName() << "'."
@@ -182,7 +182,7 @@ namespace model {
             LOG_AND_THROW("Trying to copy a ModelObject, but the copy constructors are not "
                           << "registered for IddObjectType '" << originalObjectImplPtr->iddObject().type().valueName() << "'.");
           }
-          result = std::shared_ptr<GenericModelObject_Impl>(new GenericModelObject_Impl(*originalObjectImplPtr, this, keepHandle));
+          result = openstudio::detail::makeWorkspaceObject<GenericModelObject_Impl>(objectArena(), *originalObjectImplPtr, this, keepHandle);
         }
       }
 
@@ -3902,7 +3902,7 @@ namespace model {
   detail::Model_Impl::ModelObjectCreator::ModelObjectCreator() {
 #define REGISTER_CONSTRUCTOR(_className)                                                                                           \
   m_newMap[_className::iddObjectType()] = [](openstudio::model::detail::Model_Impl* m, const IdfObject& object, bool keepHandle) { \
-    return std::make_shared<_className##_Impl>(object, m, keepHandle);                                                             \
+    return openstudio::detail::makeWorkspaceObject<_className##_Impl>(m->objectArena(), object, m, keepHandle);                    \
   };
 
     REGISTER_CONSTRUCTOR(AdditionalProperties);
@@ -4478,10 +4478,11 @@ namespace model {
   m_copyMap[_className::iddObjectType()] = [](openstudio::model::detail::Model_Impl* m,                                                \
                                               const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& ptr, bool keepHandle) { \
     if (dynamic_pointer_cast<_className##_Impl>(ptr)) {                                                                                \
-      return std::make_shared<_className##_Impl>(*dynamic_pointer_cast<_className##_Impl>(ptr), m, keepHandle);                        \
+      return openstudio::detail::makeWorkspaceObject<_className##_Impl>(                                                               \
+        m->objectArena(), *dynamic_pointer_cast<_className##_Impl>(ptr), m, keepHandle);                                               \
     } else {                                                                                                                           \
       OS_ASSERT(!dynamic_pointer_cast<openstudio::model::detail::ModelObject_Impl>(ptr));                                              \
-      return std::make_shared<_className##_Impl>(*ptr, m, keepHandle);                                                                 \
+      return openstudio::detail::makeWorkspaceObject<_className##_Impl>(m->objectArena(), *ptr, m, keepHandle);                        \
     }                                                                                                                                  \
   };
     REGISTER_COPYCONSTRUCTORS(AdditionalProperties);
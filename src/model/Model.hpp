@@ -491,16 +491,16 @@ namespace model {
     template <typename T>
     std::vector<T> getConcreteModelObjects() const {
       std::vector<T> result;
-      std::vector<WorkspaceObject> objects = this->getObjectsByType(T::iddObjectType());
-      result.reserve(objects.size());
-      for (const auto& wo : objects) {
-        std::shared_ptr<typename T::ImplType> p = wo.getImpl<typename T::ImplType>();
+      result.reserve(this->numObjectsOfType(T::iddObjectType()));
+      // walk the objects of the type directly, rather than through a temporary vector of WorkspaceObjects
+      this->forEachObjectOfType(T::iddObjectType(), [&result](const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& impl) {
+        std::shared_ptr<typename T::ImplType> p = std::dynamic_pointer_cast<typename T::ImplType>(impl);
         if (p) {
           // emplace_back(std::move(p)) did not work, calling a protected constructor...
           // the std::allocator for vector can forward to free functions...
           result.push_back(T(std::move(p)));
         }
-      }
+      });
       return result;
     }
 
@@ -222,27 +222,6 @@ namespace model {
       std::string sqlName = name().get();
       boost::to_upper(sqlName);
 
-      // Query the InitializationSummary -> Component Sizing table to get
-      // the row names that contains information for this component.
-      const std::string rowsQuery = R"(
-      SELECT RowName FROM TabularDataWithStrings
-        WHERE ReportName = 'InitializationSummary'
-        AND ReportForString = 'Entire Facility'
-        AND TableName = 'Component Sizing Information'
-        AND Value = ?;)";
-
-      boost::optional<std::vector<std::string>> rowNames = model().sqlFile().get().execAndReturnVectorOfString(rowsQuery,
-                                                                                                               // bindArgs
-                                                                                                               sqlName);
-
-      // Warn if the query failed
-      if (!rowNames) {
-        LOG(Warn, "Could not find a component called '" + sqlName + "' in any rows of the InitializationSummary Component Sizing table.");
-        return boost::none;
-      }
-
-      // Query each row of the InitializationSummary -> Component Sizing table
-      // that contains this component to get the desired value.
       std::string valueNameAndUnits = valueName + std::string(" [") + units + std::string("]");
       if (units.empty()) {
         valueNameAndUnits = valueName;
@@ -250,36 +229,12 @@ namespace model {
         valueNameAndUnits = valueName + std::string(" []");
       }
 
-      for (const std::string& rowName : rowNames.get()) {
-        const std::string rowCheckQuery = R"(
-        SELECT Value FROM TabularDataWithStrings
-          WHERE ReportName = 'InitializationSummary'
-          AND ReportForString = 'Entire Facility'
-          AND TableName = 'Component Sizing Information'
-          AND RowName = ?
-          AND Value = ?;)";
-        const boost::optional<std::string> rowValueName = model().sqlFile().get().execAndReturnFirstString(rowCheckQuery,
-                                                                                                           // bindArgs
-                                                                                                           rowName, valueNameAndUnits);
-        // Check if the query succeeded
-        if (!rowValueName) {
-          continue;
-        }
-        // This is the right row
-        const std::string valQuery = R"(
-        SELECT Value FROM TabularDataWithStrings
-          WHERE ReportName = 'InitializationSummary'
-          AND ReportForString = 'Entire Facility'
-          AND TableName = 'Component Sizing Information'
-          AND ColumnName='Value'
-          AND RowName = ?;)";
-        boost::optional<double> val = model().sqlFile().get().execAndReturnFirstDouble(valQuery,
-                                                                                       // bindArgs
-                                                                                       rowName);
-        // Check if the query succeeded and return if so
-        if (val) {
-          return val;
-        }
+      // Find the first row of the InitializationSummary -> Component Sizing table that contains
+      // both this component and the desired value name, and return its value. The SqlFile loads
+      // the table in memory on first use.
+      boost::optional<double> val = model().sqlFile().get().componentSizingInformationValue(sqlName, valueNameAndUnits);
+      if (val) {
+        return val;
       }
 
       LOG(Debug, "The autosized value query for " + valueNameAndUnits + " of " + sqlName + " returned no value.");
@@ -313,16 +268,8 @@ namespace model {
         boost::replace_all(overrideCompType, "OS:", "");
       }
 
-      const std::string directQuery = R"sql(
-      SELECT Value FROM ComponentSizes
-        WHERE CompType = ?
-          AND CompName = ?
-          AND Description = ?
-          AND Units = ?;
-    )sql";
-      boost::optional<double> val = model().sqlFile().get().execAndReturnFirstDouble(directQuery,
-                                                                                     // bindArgs
-                                                                                     overrideCompType, sqlName, valueName, units);
+      // Looked up in the SqlFile's in-memory index of the ComponentSizes table
+      boost::optional<double> val = model().sqlFile().get().componentSizeValue(overrideCompType, sqlName, valueName, units);
       if (!val) {
         LOG(Debug, fmt::format(R"sql(The direct query failed:
 SELECT Value FROM ComponentSizes
@@ -156,6 +156,7 @@ namespace model {
     std::vector<int> getActiveRuleIndices(const openstudio::Date& startDate, const openstudio::Date& endDate) const;
 
     /// Returns a vector of day schedules between start date (inclusive) and end date (inclusive).
+    /// See ScheduleRulesetEvaluator to get the values of a ScheduleRuleset at each timestep of the year.
     std::vector<ScheduleDay> getDaySchedules(const openstudio::Date& startDate, const openstudio::Date& endDate) const;
 
     //@}
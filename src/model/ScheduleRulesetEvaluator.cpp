@@ -0,0 +1,197 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "ScheduleRulesetEvaluator.hpp"
+
+#include "Model.hpp"
+#include "ScheduleRule.hpp"
+#include "ScheduleRuleset_Impl.hpp"
+#include "Timestep.hpp"
+#include "YearDescription.hpp"
+
+#include "../utilities/core/Assert.hpp"
+#include "../utilities/data/TimeSeries.hpp"
+#include "../utilities/data/Vector.hpp"
+#include "../utilities/time/Date.hpp"
+#include "../utilities/time/DateTime.hpp"
+#include "../utilities/time/Time.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+namespace model {
+
+  struct ScheduleRulesetEvaluator::Calendar
+  {
+    int year;
+    unsigned numberOfDays;
+    unsigned numberOfTimestepsPerHour;
+    // DayOfWeek value of each day of the year
+    std::vector<unsigned char> daysOfWeek;
+  };
+
+  ScheduleRulesetEvaluator::ScheduleRulesetEvaluator(const ScheduleRuleset& scheduleRuleset)
+    : m_scheduleRuleset(scheduleRuleset), m_calendar(makeCalendar(scheduleRuleset.model())) {
+    compile();
+  }
+
+  ScheduleRulesetEvaluator::ScheduleRulesetEvaluator(const ScheduleRuleset& scheduleRuleset, const std::shared_ptr<const Calendar>& calendar)
+    : m_scheduleRuleset(scheduleRuleset), m_calendar(calendar) {
+    compile();
+  }
+
+  std::vector<ScheduleRulesetEvaluator> ScheduleRulesetEvaluator::evaluateAll(const Model& model) {
+    std::vector<ScheduleRulesetEvaluator> result;
+    std::vector<ScheduleRuleset> scheduleRulesets = model.getConcreteModelObjects<ScheduleRuleset>();
+    if (scheduleRulesets.empty()) {
+      return result;
+    }
+
+    std::shared_ptr<const Calendar> calendar = makeCalendar(model);
+    result.reserve(scheduleRulesets.size());
+    for (const ScheduleRuleset& scheduleRuleset : scheduleRulesets) {
+      result.push_back(ScheduleRulesetEvaluator(scheduleRuleset, calendar));
+    }
+    return result;
+  }
+
+  ScheduleRuleset ScheduleRulesetEvaluator::scheduleRuleset() const {
+    return m_scheduleRuleset;
+  }
+
+  int ScheduleRulesetEvaluator::year() const {
+    return m_calendar->year;
+  }
+
+  unsigned ScheduleRulesetEvaluator::numberOfDays() const {
+    return m_calendar->numberOfDays;
+  }
+
+  unsigned ScheduleRulesetEvaluator::numberOfTimestepsPerHour() const {
+    return m_calendar->numberOfTimestepsPerHour;
+  }
+
+  const std::vector<int>& ScheduleRulesetEvaluator::activeRuleIndices() const {
+    return m_activeRuleIndices;
+  }
+
+  ScheduleDay ScheduleRulesetEvaluator::daySchedule(unsigned dayOfYear) const {
+    OS_ASSERT((dayOfYear >= 1) && (dayOfYear <= m_calendar->numberOfDays));
+    return m_daySchedules[m_activeRuleIndices[dayOfYear - 1] + 1];
+  }
+
+  const std::vector<double>& ScheduleRulesetEvaluator::dayValues(unsigned dayOfYear) const {
+    OS_ASSERT((dayOfYear >= 1) && (dayOfYear <= m_calendar->numberOfDays));
+    return m_dayValues[m_activeRuleIndices[dayOfYear - 1] + 1];
+  }
+
+  std::vector<double> ScheduleRulesetEvaluator::annualValues() const {
+    const std::size_t valuesPerDay = 24 * m_calendar->numberOfTimestepsPerHour;
+    std::vector<double> result(m_calendar->numberOfDays * valuesPerDay);
+    auto it = result.begin();
+    for (int ruleIndex : m_activeRuleIndices) {
+      it = std::copy(m_dayValues[ruleIndex + 1].begin(), m_dayValues[ruleIndex + 1].end(), it);
+    }
+    return result;
+  }
+
+  openstudio::TimeSeries ScheduleRulesetEvaluator::annualTimeSeries() const {
+    std::vector<double> values = annualValues();
+    Vector tsValues(values.size());
+    std::copy(values.begin(), values.end(), tsValues.begin());
+    Time interval(0, 0, 60 / m_calendar->numberOfTimestepsPerHour, 0);
+    return {Date(MonthOfYear::Jan, 1, m_calendar->year), interval, tsValues, ""};
+  }
+
+  std::shared_ptr<const ScheduleRulesetEvaluator::Calendar> ScheduleRulesetEvaluator::makeCalendar(const Model& model) {
+    // ScheduleRule dates are made with the YearDescription, which they create if there is none
+    Model m = model;
+    YearDescription yearDescription = m.getUniqueModelObject<YearDescription>();
+
+    auto result = std::make_shared<Calendar>();
+    result->year = yearDescription.assumedYear();
+    result->numberOfDays = Date(MonthOfYear::Dec, 31, result->year).dayOfYear();
+
+    result->numberOfTimestepsPerHour = 6;
+    if (boost::optional<Timestep> timestep = model.timestep()) {
+      result->numberOfTimestepsPerHour = timestep->numberOfTimestepsPerHour();
+    }
+
+    result->daysOfWeek.resize(result->numberOfDays);
+    unsigned dayOfWeek = Date(MonthOfYear::Jan, 1, result->year).dayOfWeek().value();
+    for (unsigned i = 0; i < result->numberOfDays; ++i) {
+      result->daysOfWeek[i] = static_cast<unsigned char>((dayOfWeek + i) % 7);
+    }
+
+    return result;
+  }
+
+  void ScheduleRulesetEvaluator::compile() {
+    const unsigned numberOfDays = m_calendar->numberOfDays;
+    const std::size_t valuesPerDay = 24 * m_calendar->numberOfTimestepsPerHour;
+
+    m_activeRuleIndices.assign(numberOfDays, -1);
+    m_daySchedules.clear();
+    m_daySchedules.push_back(m_scheduleRuleset.defaultDaySchedule());
+
+    // rules are in priority order, a day keeps the first rule that applies to it
+    std::vector<ScheduleRule> scheduleRules = m_scheduleRuleset.scheduleRules();
+    unsigned numberOfDaysLeft = numberOfDays;
+    for (unsigned i = 0; i < scheduleRules.size(); ++i) {
+      const ScheduleRule& scheduleRule = scheduleRules[i];
+      m_daySchedules.push_back(scheduleRule.daySchedule());
+      if (numberOfDaysLeft == 0) {
+        continue;
+      }
+
+      // DayOfWeek values the rule applies to
+      bool applyDayOfWeek[7] = {scheduleRule.applySunday(),   scheduleRule.applyMonday(), scheduleRule.applyTuesday(),
+                                scheduleRule.applyWednesday(), scheduleRule.applyThursday(), scheduleRule.applyFriday(),
+                                scheduleRule.applySaturday()};
+
+      // days of the year in the rule's dates
+      std::vector<bool> inDates(numberOfDays, false);
+      boost::optional<Date> startDate = scheduleRule.startDate();
+      boost::optional<Date> endDate = scheduleRule.endDate();
+      if (startDate && endDate) {
+        unsigned start = startDate->dayOfYear();
+        unsigned end = endDate->dayOfYear();
+        for (unsigned day = 1; day <= numberOfDays; ++day) {
+          inDates[day - 1] = (start <= end) ? ((day >= start) && (day <= end)) : ((day >= start) || (day <= end));
+        }
+      } else {
+        for (const Date& specificDate : scheduleRule.specificDates()) {
+          unsigned day = specificDate.dayOfYear();
+          if (day <= numberOfDays) {
+            inDates[day - 1] = true;
+          }
+        }
+      }
+
+      for (unsigned d = 0; d < numberOfDays; ++d) {
+        if ((m_activeRuleIndices[d] == -1) && inDates[d] && applyDayOfWeek[m_calendar->daysOfWeek[d]]) {
+          m_activeRuleIndices[d] = static_cast<int>(i);
+          --numberOfDaysLeft;
+        }
+      }
+    }
+
+    // profile of each day schedule at the simulation timestep
+    m_dayValues.clear();
+    m_dayValues.reserve(m_daySchedules.size());
+    for (const ScheduleDay& daySchedule : m_daySchedules) {
+      Vector values = daySchedule.timeSeries().values();
+      std::vector<double> dayValues(values.begin(), values.end());
+      if (dayValues.size() != valuesPerDay) {
+        LOG(Warn, "Day schedule '" << daySchedule.nameString() << "' has " << dayValues.size() << " values at the timestep instead of "
+                                   << valuesPerDay << ", missing values are set to 0");
+        dayValues.resize(valuesPerDay, 0.0);
+      }
+      m_dayValues.push_back(std::move(dayValues));
+    }
+  }
+
+}  // namespace model
+}  // namespace openstudio
@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef MODEL_SCHEDULERULESETEVALUATOR_HPP
+#define MODEL_SCHEDULERULESETEVALUATOR_HPP
+
+#include "ModelAPI.hpp"
+#include "ScheduleDay.hpp"
+#include "ScheduleRuleset.hpp"
+
+#include "../utilities/core/Logger.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace openstudio {
+
+class TimeSeries;
+
+namespace model {
+
+  class Model;
+
+  /** ScheduleRulesetEvaluator evaluates a ScheduleRuleset over a whole year. On construction, the rules are flattened
+   *  into the index of the active rule for each day of the year, and the values of each day schedule are computed once
+   *  at the simulation timestep. The annual values are then copied from these day profiles, without going back to the
+   *  rules or the ScheduleDay fields.
+   *
+   *  The year is the assumed year of the model's YearDescription, and the timestep is the model's Timestep (6 per hour
+   *  if there is none). As in ScheduleRuleset::getDaySchedules, rules are applied in priority order and the default
+   *  day schedule is used on days that no rule applies to; holidays and design days are not considered.
+   *
+   *  The evaluator is a snapshot: it is not updated when the ScheduleRuleset changes. */
+  class MODEL_API ScheduleRulesetEvaluator
+  {
+   public:
+    /** @name Constructors and Destructors */
+    //@{
+
+    explicit ScheduleRulesetEvaluator(const ScheduleRuleset& scheduleRuleset);
+
+    /** Returns an evaluator for each ScheduleRuleset in model, in the order of
+     *  model.getConcreteModelObjects<ScheduleRuleset>(). The calendar and timestep are looked up once for all of them. */
+    static std::vector<ScheduleRulesetEvaluator> evaluateAll(const Model& model);
+
+    //@}
+    /** @name Getters */
+    //@{
+
+    ScheduleRuleset scheduleRuleset() const;
+
+    /// Year the days are evaluated for.
+    int year() const;
+
+    unsigned numberOfDays() const;
+
+    unsigned numberOfTimestepsPerHour() const;
+
+    /// Index into scheduleRuleset().scheduleRules() of the rule in place on each day of the year, -1 if no rule is in place.
+    const std::vector<int>& activeRuleIndices() const;
+
+    /// Returns the day schedule in place on dayOfYear, which starts at 1.
+    ScheduleDay daySchedule(unsigned dayOfYear) const;
+
+    /// Returns the values at each timestep of the day schedule in place on dayOfYear, which starts at 1.
+    const std::vector<double>& dayValues(unsigned dayOfYear) const;
+
+    /// Returns the value at each timestep of the year, numberOfDays() * 24 * numberOfTimestepsPerHour() values.
+    std::vector<double> annualValues() const;
+
+    /// Returns annualValues() as a TimeSeries starting on January 1st of year().
+    openstudio::TimeSeries annualTimeSeries() const;
+
+    //@}
+
+   private:
+    struct Calendar;
+
+    ScheduleRulesetEvaluator(const ScheduleRuleset& scheduleRuleset, const std::shared_ptr<const Calendar>& calendar);
+
+    static std::shared_ptr<const Calendar> makeCalendar(const Model& model);
+
+    void compile();
+
+    ScheduleRuleset m_scheduleRuleset;
+    std::shared_ptr<const Calendar> m_calendar;
+    std::vector<int> m_activeRuleIndices;
+    // the default day schedule, then the day schedule of each rule
+    std::vector<ScheduleDay> m_daySchedules;
+    std::vector<std::vector<double>> m_dayValues;
+
+    REGISTER_LOGGER("openstudio.model.ScheduleRulesetEvaluator");
+  };
+
+}  // namespace model
+}  // namespace openstudio
+
+#endif  // MODEL_SCHEDULERULESETEVALUATOR_HPP
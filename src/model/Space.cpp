@@ -122,6 +122,7 @@
 #include <boost/geometry/geometries/ring.hpp>
 #include <boost/geometry/multi/geometries/multi_polygon.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #if defined(_MSC_VER)
 #  pragma warning(pop)
 #endif
@@ -2412,6 +2413,17 @@ namespace model {
       // transform from other to this coordinates
       Transformation transformation = this->transformation().inverse() * other.transformation();
 
+      // vertices of the other surfaces in this coordinates, and their outward normals, for all the surfaces of this space
+      std::vector<Surface> otherSurfaces = other.surfaces();
+      std::vector<std::vector<Point3d>> otherSurfacesVertices;
+      std::vector<boost::optional<Vector3d>> otherOutwardNormals;
+      otherSurfacesVertices.reserve(otherSurfaces.size());
+      otherOutwardNormals.reserve(otherSurfaces.size());
+      for (const Surface& otherSurface : otherSurfaces) {
+        otherSurfacesVertices.push_back(transformation * otherSurface.vertices());
+        otherOutwardNormals.push_back(getOutwardNormal(otherSurfacesVertices.back()));
+      }
+
       for (Surface& surface : this->surfaces()) {
         if (surface.adjacentSurface()) {
           continue;
@@ -2422,12 +2434,12 @@ namespace model {
           continue;
         }
 
-        for (Surface& otherSurface : other.surfaces()) {
+        for (size_t i = 0; i < otherSurfaces.size(); ++i) {
+          Surface& otherSurface = otherSurfaces[i];
           if (otherSurface.adjacentSurface()) {
             continue;
           }
-          std::vector<Point3d> otherVertices = transformation * otherSurface.vertices();
-          boost::optional<Vector3d> otherOutwardNormal = getOutwardNormal(otherVertices);
+          const boost::optional<Vector3d>& otherOutwardNormal = otherOutwardNormals[i];
           if (!otherOutwardNormal) {
             continue;
           }
@@ -2438,7 +2450,7 @@ namespace model {
             continue;
           }
 
-          std::reverse(otherVertices.begin(), otherVertices.end());
+          std::vector<Point3d> otherVertices(otherSurfacesVertices[i].rbegin(), otherSurfacesVertices[i].rend());
 
           if (circularEqual(vertices, otherVertices, tol)) {
 
@@ -3759,6 +3771,56 @@ namespace model {
   Space::Space(std::shared_ptr<detail::Space_Impl> impl) : PlanarSurfaceGroup(std::move(impl)) {}
   /// @endcond
 
+  namespace {
+
+    // pairs (i, j) with i < j of the bounds that intersect, in increasing order, as found by testing every pair
+    std::vector<std::pair<size_t, size_t>> intersectingPairs(const std::vector<BoundingBox>& bounds) {
+      namespace bg = boost::geometry;
+      namespace bgi = boost::geometry::index;
+      using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+      using Box = bg::model::box<Point>;
+
+      // the default tolerance of BoundingBox::intersects
+      constexpr double tol = 0.01;
+
+      std::vector<std::pair<Box, size_t>> boxes;
+      boxes.reserve(bounds.size());
+      for (size_t i = 0; i < bounds.size(); ++i) {
+        const BoundingBox& b = bounds[i];
+        if (!b.isEmpty()) {
+          boxes.emplace_back(Box(Point(*b.minX(), *b.minY(), *b.minZ()), Point(*b.maxX(), *b.maxY(), *b.maxZ())), i);
+        }
+      }
+      // packing is much faster than inserting one by one
+      const bgi::rtree<std::pair<Box, size_t>, bgi::rstar<16>> rtree(boxes);
+
+      std::vector<std::pair<size_t, size_t>> result;
+      std::vector<std::pair<Box, size_t>> candidates;
+      std::vector<size_t> js;
+      for (const auto& [box, i] : boxes) {
+        // twice the tolerance so that rounding does not lose pairs, the exact test below discards the extra ones
+        const Box query(Point(box.min_corner().get<0>() - 2 * tol, box.min_corner().get<1>() - 2 * tol, box.min_corner().get<2>() - 2 * tol),
+                        Point(box.max_corner().get<0>() + 2 * tol, box.max_corner().get<1>() + 2 * tol, box.max_corner().get<2>() + 2 * tol));
+        candidates.clear();
+        rtree.query(bgi::intersects(query), std::back_inserter(candidates));
+
+        js.clear();
+        for (const auto& candidate : candidates) {
+          const size_t j = candidate.second;
+          if ((j > i) && bounds[i].intersects(bounds[j], tol)) {
+            js.push_back(j);
+          }
+        }
+        std::sort(js.begin(), js.end());
+        for (size_t j : js) {
+          result.emplace_back(i, j);
+        }
+      }
+      return result;
+    }
+
+  }  // namespace
+
   void intersectSurfaces(std::vector<Space>& t_spaces) {
     std::vector<Space> spaces(t_spaces);
     std::sort(spaces.begin(), spaces.end(), [](const Space& a, const Space& b) -> bool { return a.floorArea() < b.floorArea(); });
@@ -3768,13 +3830,8 @@ namespace model {
       bounds.push_back(space.transformation() * space.boundingBox());
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
-        }
-        spaces[i].intersectSurfaces(spaces[j]);
-      }
+    for (const auto& [i, j] : intersectingPairs(bounds)) {
+      spaces[i].intersectSurfaces(spaces[j]);
     }
   }
 
@@ -3784,13 +3841,8 @@ namespace model {
       bounds.push_back(space.transformation() * space.boundingBox());
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
-        }
-        spaces[i].matchSurfaces(spaces[j]);
-      }
+    for (const auto& [i, j] : intersectingPairs(bounds)) {
+      spaces[i].matchSurfaces(spaces[j]);
     }
   }
 
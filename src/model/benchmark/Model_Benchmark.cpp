@@ -22,9 +22,17 @@
 #include <utilities/idd/IddFactory.hxx>
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/FileLogSink.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
 
 #include <fmt/format.h>
 
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#  include <unistd.h>
+#endif
+
 //#include <iostream>
 
 using namespace openstudio;
@@ -95,6 +103,50 @@ static void BM_SetUpPlantLoop(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+// Resident set size of the process in MB, 0 where not available
+static double residentSetSizeMB() {
+#ifdef __linux__
+  std::ifstream statm("/proc/self/statm");
+  long totalPages = 0;
+  long residentPages = 0;
+  if (statm >> totalPages >> residentPages) {
+    return static_cast<double>(residentPages) * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+  }
+#endif
+  return 0.0;
+}
+
+// Load N copies of exampleModel and hold on to all of them, range(1) turns per-workspace object arenas on
+static void BM_LoadExampleModels(benchmark::State& state) {
+
+  std::stringstream ss;
+  ss << exampleModel().toIdfFile();
+  const std::string text = ss.str();
+
+  Workspace::setUseObjectArenaByDefault(state.range(1) != 0);
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    double rssBefore = residentSetSizeMB();
+    std::vector<Model> models;
+    models.reserve(state.range(0));
+    for (auto i = 0; i < state.range(0); ++i) {
+      std::istringstream is(text);
+      boost::optional<IdfFile> idfFile = IdfFile::load(is, IddFileType::OpenStudio);
+      models.emplace_back(*idfFile);
+    }
+    state.counters["RSS_MB"] = residentSetSizeMB();
+    state.counters["RSS_Growth_MB"] = residentSetSizeMB() - rssBefore;
+
+    state.PauseTiming();
+    models.clear();
+    state.ResumeTiming();
+  }
+
+  Workspace::setUseObjectArenaByDefault(false);
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -107,6 +159,9 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 // With Complexity
 BENCHMARK(BM_AddObjects)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(8, 4096)->Complexity();
 
+// exampleModel x256, heap vs object arena. Run each configuration in its own process (--benchmark_filter) for comparable RSS numbers
+BENCHMARK(BM_LoadExampleModels)->Unit(benchmark::kMillisecond)->ArgNames({"models", "arena"})->Args({256, 0})->Args({256, 1})->Iterations(1);
+
 // 128 takes 14secs,  512 takes about 300 seconds, 1024 takes 20 minutes. By interpolation, 4096 would take 636 minutes, 8192 = 2567 minutes = 42 h
 // 'y[ms] = 1.156580334046908*x**2 + -72.31709114930806*x + 1397.3555792110117'
 BENCHMARK(BM_SetUpPlantLoop)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(1, 128)->Complexity();
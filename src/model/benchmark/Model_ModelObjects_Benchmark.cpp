@@ -145,3 +145,49 @@ BENCHMARK(ProposedEmplace)
   ->RangeMultiplier(2)
   ->Range(4, 1024)
   ->Complexity();
+
+static void BM_GetConcreteModelObjectsSurface(benchmark::State& state) {
+
+  Model m = makeModelWithNSurfaces(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<Surface> surfaces = m.getConcreteModelObjects<Surface>();
+    benchmark::DoNotOptimize(surfaces);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// For comparison, the WorkspaceObjects that getConcreteModelObjects used to go through
+static void BM_GetObjectsByTypeSurface(benchmark::State& state) {
+
+  Model m = makeModelWithNSurfaces(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<WorkspaceObject> objects = m.getObjectsByType(Surface::iddObjectType());
+    benchmark::DoNotOptimize(objects);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_ForEachObjectOfTypeSurface(benchmark::State& state) {
+
+  Model m = makeModelWithNSurfaces(state.range(0));
+
+  for (auto _ : state) {
+    size_t n = 0;
+    m.forEachObjectOfType(Surface::iddObjectType(), [&n](const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& impl) {
+      n += impl->numFields();
+    });
+    benchmark::DoNotOptimize(n);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_GetConcreteModelObjectsSurface)->Unit(benchmark::kMillisecond)->RangeMultiplier(10)->Range(100, 100000)->Complexity();
+
+BENCHMARK(BM_GetObjectsByTypeSurface)->Unit(benchmark::kMillisecond)->RangeMultiplier(10)->Range(100, 100000)->Complexity();
+
+BENCHMARK(BM_ForEachObjectOfTypeSurface)->Unit(benchmark::kMillisecond)->RangeMultiplier(10)->Range(100, 100000)->Complexity();
@@ -0,0 +1,80 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+
+#include "../Surface.hpp"
+#include "../Surface_Impl.hpp"
+
+#include "../../utilities/idf/IdfExtensibleGroup.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/core/Assert.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// nSurfaces horizontal polygons of nVertices vertices each
+model::Model makeModelWithNSurfaces(size_t nSurfaces, size_t nVertices) {
+  Model m;
+  Point3dVector pts;
+  for (size_t i = 0; i < nVertices; ++i) {
+    double angle = -2.0 * M_PI * static_cast<double>(i) / static_cast<double>(nVertices);
+    pts.emplace_back(10.0 * std::cos(angle), 10.0 * std::sin(angle), 3.0);
+  }
+
+  for (size_t i = 0; i < nSurfaces; ++i) {
+    Surface(pts, m);
+  }
+
+  OS_ASSERT(m.getConcreteModelObjects<Surface>().size() == nSurfaces);
+  return m;
+}
+
+// Reads every vertex field, as PlanarSurface_Impl::vertices() does before its result is cached
+static void BM_SurfaceVertexFields(benchmark::State& state) {
+
+  Model m = makeModelWithNSurfaces(state.range(0), 64);
+  std::vector<Surface> surfaces = m.getConcreteModelObjects<Surface>();
+
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& surface : surfaces) {
+      for (const auto& group : surface.extensibleGroups()) {
+        sum += group.getDouble(0).get() + group.getDouble(1).get() + group.getDouble(2).get();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Typical geometry measure: read the vertices of every surface, then move them
+static void BM_SurfaceTranslateVertices(benchmark::State& state) {
+
+  Model m = makeModelWithNSurfaces(state.range(0), 64);
+  std::vector<Surface> surfaces = m.getConcreteModelObjects<Surface>();
+
+  for (auto _ : state) {
+    for (auto& surface : surfaces) {
+      Point3dVector pts = surface.vertices();
+      for (auto& pt : pts) {
+        pt = Point3d(pt.x() + 1.0, pt.y(), pt.z());
+      }
+      surface.setVertices(pts);
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_SurfaceVertexFields)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+
+BENCHMARK(BM_SurfaceTranslateVertices)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
@@ -0,0 +1,80 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+
+#include "../Space.hpp"
+#include "../Space_Impl.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/core/Assert.hpp"
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// nSpaces 1x1x2 spaces on a square grid, 16 per story, so that each space touches its neighbors
+model::Model makeModelWithNSpacesOnGrid(size_t nSpaces) {
+
+  Model m;
+
+  constexpr size_t nSpacesPerStory = 16;
+  constexpr size_t nSpacesPerRow = 4;
+  constexpr double floorHeight = 2.0;
+
+  for (size_t i = 0; i < nSpaces; ++i) {
+    const auto x = static_cast<double>(i % nSpacesPerRow);
+    const auto y = static_cast<double>((i % nSpacesPerStory) / nSpacesPerRow);
+    const double z = floorHeight * static_cast<double>(i / nSpacesPerStory);
+
+    Point3dVector pts{{x, y, z}, {x, y + 1, z}, {x + 1, y + 1, z}, {x + 1, y, z}};
+    auto space_ = Space::fromFloorPrint(pts, floorHeight, m);
+    OS_ASSERT(space_);
+  }
+
+  OS_ASSERT(m.getConcreteModelObjects<Space>().size() == nSpaces);
+
+  return m;
+}
+
+static void BM_MatchSurfaces(benchmark::State& state) {
+
+  Model m = makeModelWithNSpacesOnGrid(state.range(0));
+  std::vector<Space> spaces = m.getConcreteModelObjects<Space>();
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+
+    state.PauseTiming();
+    unmatchSurfaces(spaces);
+    state.ResumeTiming();
+
+    matchSurfaces(spaces);
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_IntersectSurfaces(benchmark::State& state) {
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+
+    // intersecting splits the surfaces, start from a new model each time
+    state.PauseTiming();
+    Model m = makeModelWithNSpacesOnGrid(state.range(0));
+    std::vector<Space> spaces = m.getConcreteModelObjects<Space>();
+    state.ResumeTiming();
+
+    intersectSurfaces(spaces);
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Candidate pairs of spaces come from an R-tree over their bounding boxes, so these should scale close to linearly
+BENCHMARK(BM_MatchSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 16 << 10)->Complexity();
+
+BENCHMARK(BM_IntersectSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 16 << 10)->Complexity();
@@ -18,8 +18,12 @@
 #include "../RunPeriodControlSpecialDays_Impl.hpp"
 #include "../ScheduleTypeLimits.hpp"
 #include "../ScheduleTypeLimits_Impl.hpp"
+#include "../ScheduleRulesetEvaluator.hpp"
+#include "../Timestep.hpp"
 
 #include "../../utilities/core/UUID.hpp"
+#include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/data/Vector.hpp"
 #include "../../utilities/time/Date.hpp"
 #include "../../utilities/time/Time.hpp"
 
@@ -1035,3 +1039,91 @@ Nov 11  Veterans Day
 Nov 26  Thanksgiving Day
 Dec 25  Christmas Day
 */
+
+TEST_F(ModelFixture, ScheduleRulesetEvaluator) {
+  Model model;
+
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  yd.setCalendarYear(2012);
+  model::Timestep timestep = model.getUniqueModelObject<model::Timestep>();
+  timestep.setNumberOfTimestepsPerHour(4);
+
+  ScheduleRuleset schedule(model, 0.1);
+
+  // summer weekends
+  ScheduleRule summerWeekendRule(schedule);
+  summerWeekendRule.setApplySaturday(true);
+  summerWeekendRule.setApplySunday(true);
+  summerWeekendRule.setStartDate(yd.makeDate(openstudio::MonthOfYear::Jun, 1));
+  summerWeekendRule.setEndDate(yd.makeDate(openstudio::MonthOfYear::Aug, 31));
+  summerWeekendRule.daySchedule().addValue(Time(0, 24, 0), 0.5);
+
+  // winter weekdays, wrapping around the year
+  ScheduleRule winterRule(schedule);
+  winterRule.setApplyMonday(true);
+  winterRule.setApplyTuesday(true);
+  winterRule.setApplyWednesday(true);
+  winterRule.setApplyThursday(true);
+  winterRule.setApplyFriday(true);
+  winterRule.setStartDate(yd.makeDate(openstudio::MonthOfYear::Nov, 1));
+  winterRule.setEndDate(yd.makeDate(openstudio::MonthOfYear::Feb, 29));
+  winterRule.daySchedule().addValue(Time(0, 8, 0), 0.2);
+  winterRule.daySchedule().addValue(Time(0, 17, 30), 0.8);
+  winterRule.daySchedule().addValue(Time(0, 24, 0), 0.2);
+
+  // christmas has the highest priority
+  ScheduleRule christmasRule(schedule);
+  christmasRule.setApplySunday(true);
+  christmasRule.setApplyMonday(true);
+  christmasRule.setApplyTuesday(true);
+  christmasRule.setApplyWednesday(true);
+  christmasRule.setApplyThursday(true);
+  christmasRule.setApplyFriday(true);
+  christmasRule.setApplySaturday(true);
+  christmasRule.addSpecificDate(yd.makeDate(openstudio::MonthOfYear::Dec, 25));
+  christmasRule.daySchedule().addValue(Time(0, 24, 0), 0.0);
+
+  ScheduleRulesetEvaluator evaluator(schedule);
+  EXPECT_EQ(2012, evaluator.year());
+  EXPECT_EQ(366u, evaluator.numberOfDays());
+  EXPECT_EQ(4u, evaluator.numberOfTimestepsPerHour());
+
+  // same rules as getActiveRuleIndices
+  openstudio::Date jan1 = yd.makeDate(openstudio::MonthOfYear::Jan, 1);
+  openstudio::Date dec31 = yd.makeDate(openstudio::MonthOfYear::Dec, 31);
+  std::vector<int> activeRuleIndices = schedule.getActiveRuleIndices(jan1, dec31);
+  std::vector<ScheduleDay> daySchedules = schedule.getDaySchedules(jan1, dec31);
+  ASSERT_EQ(366u, activeRuleIndices.size());
+  EXPECT_EQ(activeRuleIndices, evaluator.activeRuleIndices());
+  EXPECT_EQ(0, evaluator.activeRuleIndices()[yd.makeDate(openstudio::MonthOfYear::Dec, 25).dayOfYear() - 1]);
+
+  // same values as the day schedules
+  std::vector<double> annualValues = evaluator.annualValues();
+  ASSERT_EQ(366u * 24u * 4u, annualValues.size());
+  for (unsigned day = 1; day <= 366; ++day) {
+    EXPECT_EQ(daySchedules[day - 1].handle(), evaluator.daySchedule(day).handle());
+    Vector dayValues = daySchedules[day - 1].timeSeries().values();
+    ASSERT_EQ(96u, dayValues.size());
+    for (unsigned i = 0; i < 96; ++i) {
+      EXPECT_DOUBLE_EQ(dayValues[i], annualValues[(day - 1) * 96 + i]);
+    }
+  }
+  EXPECT_DOUBLE_EQ(0.8, evaluator.dayValues(yd.makeDate(openstudio::MonthOfYear::Jan, 3).dayOfYear())[8 * 4]);
+
+  openstudio::TimeSeries timeSeries = evaluator.annualTimeSeries();
+  EXPECT_EQ(annualValues.size(), timeSeries.values().size());
+  EXPECT_EQ(openstudio::DateTime(jan1, Time(0, 0, 15)), timeSeries.firstReportDateTime());
+
+  // batch evaluation over all the schedules in the model
+  ScheduleRuleset constantSchedule(model, 3.0);
+  std::vector<ScheduleRulesetEvaluator> evaluators = ScheduleRulesetEvaluator::evaluateAll(model);
+  ASSERT_EQ(2u, evaluators.size());
+  for (const ScheduleRulesetEvaluator& e : evaluators) {
+    if (e.scheduleRuleset().handle() == schedule.handle()) {
+      EXPECT_EQ(annualValues, e.annualValues());
+    } else {
+      EXPECT_EQ(constantSchedule.handle(), e.scheduleRuleset().handle());
+      EXPECT_EQ(std::vector<double>(366u * 24u * 4u, 3.0), e.annualValues());
+    }
+  }
+}
@@ -16,10 +16,40 @@
 namespace openstudio {
 
 /// convenience function for SWIG, prefer macros in C++
+namespace {
+  // innermost LogMessageCapture of the current thread
+  thread_local LogMessageCapture* threadLogMessageCapture = nullptr;
+}  // namespace
+
 void logFree(LogLevel level, const std::string& channel, const std::string& message) {
+  if (threadLogMessageCapture) {
+    threadLogMessageCapture->m_messages.emplace_back(level, channel, message);
+    return;
+  }
   BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
 }
 
+void logMessages(const std::vector<LogMessage>& messages) {
+  for (const LogMessage& message : messages) {
+    logFree(message.logLevel(), message.logChannel(), message.logMessage());
+  }
+}
+
+LogMessageCapture::LogMessageCapture() : m_enclosing(threadLogMessageCapture) {
+  threadLogMessageCapture = this;
+}
+
+LogMessageCapture::~LogMessageCapture() {
+  threadLogMessageCapture = m_enclosing;
+  logMessages(m_messages);
+}
+
+std::vector<LogMessage> LogMessageCapture::takeMessages() {
+  std::vector<LogMessage> result;
+  result.swap(m_messages);
+  return result;
+}
+
 // Meyers' singleton
 Logger& Logger::instance() {
   static Logger instance;
@@ -20,6 +20,7 @@
 #include <set>
 #include <shared_mutex>
 #include <sstream>
+#include <vector>
 
 /// defines method logChannel() to get a logger for a class
 #define REGISTER_LOGGER(__logChannel__)        \
@@ -61,6 +62,33 @@ namespace detail {
 /// convenience function for SWIG, prefer macros in C++
 UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
+/// log messages in order, e.g. those held back by a LogMessageCapture
+UTILITIES_API void logMessages(const std::vector<LogMessage>& messages);
+
+/** While in scope, holds back the messages logged by the thread that constructed it, instead of
+ *  sending them to the sinks. Lets worker threads hand their messages over to a thread that logs
+ *  them in a deterministic order. Captures nest, messages go to the innermost one. Messages that
+ *  were not taken are logged when the capture goes out of scope. */
+class UTILITIES_API LogMessageCapture
+{
+ public:
+  LogMessageCapture();
+
+  ~LogMessageCapture();
+
+  LogMessageCapture(const LogMessageCapture& other) = delete;
+  LogMessageCapture& operator=(const LogMessageCapture& other) = delete;
+
+  /// returns the messages held back so far, and clears them
+  std::vector<LogMessage> takeMessages();
+
+ private:
+  friend void logFree(LogLevel level, const std::string& channel, const std::string& message);
+
+  std::vector<LogMessage> m_messages;
+  LogMessageCapture* m_enclosing;
+};
+
 class UTILITIES_API Logger
 {
  public:
@@ -7,6 +7,7 @@
 #include "String.hpp"
 #include "StaticInitializer.hpp"
 
+#include <cstdint>
 #include <sstream>
 
 #include <boost/uuid/uuid_io.hpp>
@@ -60,7 +61,81 @@ UUID createUUID() {
   return UUID::random_generate();
 }
 
+namespace {
+
+  constexpr char hexDigits[] = "0123456789abcdef";
+
+  // offsets of the dashes in the 36 character form, 8-4-4-4-12
+  bool isDashPosition(std::size_t i) {
+    return (i == 8) || (i == 13) || (i == 18) || (i == 23);
+  }
+
+  int hexValue(char c) {
+    if ((c >= '0') && (c <= '9')) {
+      return c - '0';
+    }
+    if ((c >= 'a') && (c <= 'f')) {
+      return c - 'a' + 10;
+    }
+    if ((c >= 'A') && (c <= 'F')) {
+      return c - 'A' + 10;
+    }
+    return -1;
+  }
+
+  // writes the 36 character form to out, as boost::uuids::operator<< does
+  void formatUUID(const boost::uuids::uuid& uuid, char* out) {
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < 16; ++i) {
+      if (isDashPosition(j)) {
+        out[j++] = '-';
+      }
+      out[j++] = hexDigits[(uuid.data[i] >> 4) & 0x0F];
+      out[j++] = hexDigits[uuid.data[i] & 0x0F];
+    }
+  }
+
+  // parses the 36 character form, optionally in braces, which is how handles are written
+  bool parseUUID(const std::string& str, boost::uuids::uuid& uuid) {
+    std::size_t begin = 0;
+    if (str.size() == 38) {
+      if ((str.front() != '{') || (str.back() != '}')) {
+        return false;
+      }
+      begin = 1;
+    } else if (str.size() != 36) {
+      return false;
+    }
+
+    std::size_t k = 0;
+    for (std::size_t j = 0; j < 36;) {
+      if (isDashPosition(j)) {
+        if (str[begin + j] != '-') {
+          return false;
+        }
+        ++j;
+        continue;
+      }
+      int hi = hexValue(str[begin + j]);
+      int lo = hexValue(str[begin + j + 1]);
+      if ((hi < 0) || (lo < 0)) {
+        return false;
+      }
+      uuid.data[k++] = static_cast<std::uint8_t>((hi << 4) | lo);
+      j += 2;
+    }
+    return true;
+  }
+
+}  // namespace
+
 UUID toUUID(const std::string& str) {
+  boost::uuids::uuid uuid;
+  if (parseUUID(str, uuid)) {
+    return UUID(uuid);
+  }
+
+  // other forms accepted by boost, which reports errors by throwing
   try {
     return UUID::string_generate(str);
   } catch (...) {
@@ -91,11 +166,11 @@ bool operator>(const UUID& lhs, const UUID& rhs) {
 }
 
 std::string toString(const UUID& uuid) {
-  std::stringstream ss;
-  ss << '{';
-  boost::uuids::operator<<(ss, uuid);
-  ss << '}';
-  return ss.str();
+  // handles are converted to text whenever an object is printed, avoid a stringstream
+  std::string result(38, '}');
+  result[0] = '{';
+  formatUUID(uuid, &result[1]);
+  return result;
 }
 
 std::string createUniqueName(const std::string& prefix) {
@@ -108,9 +183,9 @@ std::string createUniqueName(const std::string& prefix) {
 }
 
 std::string removeBraces(const UUID& uuid) {
-  std::stringstream ss;
-  boost::uuids::operator<<(ss, uuid);
-  return ss.str();
+  std::string result(36, '-');
+  formatUUID(uuid, &result[0]);
+  return result;
 }
 
 std::ostream& operator<<(std::ostream& os, const UUID& uuid) {
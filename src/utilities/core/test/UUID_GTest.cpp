@@ -67,3 +67,20 @@ TEST(UUID, UUID_UID) {
   EXPECT_EQ(uuid, toUUID(uuidStr));
   EXPECT_EQ(uuid, toUUID(uidStr));  // no extra conversion process
 }
+
+TEST(UUID, TextForms) {
+  UUID uuid = toUUID(std::string("{0123abcd-4567-89ef-0123-456789abcdef}"));
+  ASSERT_FALSE(uuid.isNull());
+  EXPECT_EQ("{0123abcd-4567-89ef-0123-456789abcdef}", toString(uuid));
+  EXPECT_EQ("0123abcd-4567-89ef-0123-456789abcdef", removeBraces(uuid));
+
+  // forms handled by the boost string generator
+  EXPECT_EQ(uuid, toUUID(std::string("{0123ABCD-4567-89EF-0123-456789ABCDEF}")));
+  EXPECT_EQ(uuid, toUUID(std::string("0123abcd456789ef0123456789abcdef")));
+
+  // malformed
+  EXPECT_TRUE(toUUID(std::string("{0123abcd-4567-89ef-0123-456789abcdeg}")).isNull());
+  EXPECT_TRUE(toUUID(std::string("{0123abcd-4567-89ef-0123+456789abcdef}")).isNull());
+  EXPECT_TRUE(toUUID(std::string("(0123abcd-4567-89ef-0123-456789abcdef)")).isNull());
+  EXPECT_TRUE(toUUID(std::string()).isNull());
+}
@@ -1090,6 +1090,85 @@ TEST_F(DataFixture, TimeSeries_AddSubtractSameTimePeriod) {
   EXPECT_DOUBLE_EQ(6.75, ans.value(Time(0,1,30,0)));*/
 }
 
+TEST_F(DataFixture, TimeSeries_IntervalAxisNotStored) {
+  // the time axis of an interval series is computed from the interval length
+  Date startDate(MonthOfYear(MonthOfYear::Jan), 1, 2019);
+  Time interval(0, 0, 10, 0);
+  Vector values = linspace(1, 52560, 52560);
+  TimeSeries timeSeries(startDate, interval, values, "W");
+
+  std::vector<long> seconds = timeSeries.secondsFromFirstReport();
+  ASSERT_EQ(52560u, seconds.size());
+  EXPECT_EQ(0, seconds.front());
+  EXPECT_EQ(52559 * 600, seconds.back());
+  EXPECT_EQ(600, timeSeries.secondsFromFirstReport(1));
+  EXPECT_EQ(0, timeSeries.secondsFromFirstReport(52560));
+  EXPECT_EQ(52560u, timeSeries.dateTimes().size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Dec), 31, 2019), Time(0, 24, 0, 0)), timeSeries.dateTimes().back());
+
+  // each value covers the interval ending at its report
+  EXPECT_EQ(1.0, timeSeries.value(DateTime(startDate, Time(0, 0, 1, 0))));
+  EXPECT_EQ(1.0, timeSeries.value(DateTime(startDate, Time(0, 0, 10, 0))));
+  EXPECT_EQ(2.0, timeSeries.value(DateTime(startDate, Time(0, 0, 10, 1))));
+  EXPECT_EQ(52560.0, timeSeries.value(DateTime(Date(MonthOfYear(MonthOfYear::Dec), 31, 2019), Time(0, 23, 55, 0))));
+  EXPECT_EQ(0.0, timeSeries.value(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 1, 2020), Time(0, 0, 5, 0))));
+
+  EXPECT_DOUBLE_EQ((1.0 + 52560.0) / 2.0, timeSeries.averageValue());
+}
+
+TEST_F(DataFixture, TimeSeries_SumSharedInterval) {
+  std::string units = "J";
+  Date startDate(MonthOfYear(MonthOfYear::Jan), 1);
+  DateTime firstReportDateTime(startDate, Time(0, 0, 15, 0));
+  Time interval(0, 0, 15, 0);
+
+  // series on the same 15 minute axis, the last one is a day shorter
+  std::vector<TimeSeries> series;
+  for (unsigned k = 0; k < 4; ++k) {
+    unsigned n = (k == 3) ? 35040 - 96 : 35040;
+    Vector values(n);
+    for (unsigned i = 0; i < n; ++i) {
+      values[i] = k + 0.001 * i;
+    }
+    series.emplace_back(firstReportDateTime, interval, values, units);
+  }
+  series[3].setOutOfRangeValue(100.0);
+
+  TimeSeries total = openstudio::sum(series);
+  ASSERT_EQ(35040u, total.values().size());
+  ASSERT_TRUE(total.intervalLength());
+  EXPECT_EQ(interval, total.intervalLength().get());
+  EXPECT_EQ(firstReportDateTime, total.firstReportDateTime());
+  EXPECT_DOUBLE_EQ(0.0 + 1.0 + 2.0 + 3.0, total.values(0));
+  EXPECT_DOUBLE_EQ(6.0 + 4 * 0.001 * 1000, total.values(1000));
+  // past the end of the shorter series, its out of range value is used
+  EXPECT_DOUBLE_EQ(3.0 + 3 * 0.001 * 35000 + 100.0, total.values(35000));
+
+  // pairwise operators take the same path
+  TimeSeries diff = series[1] - series[0];
+  ASSERT_TRUE(diff.intervalLength());
+  EXPECT_DOUBLE_EQ(1.0, diff.values(20000));
+
+  // a series on another axis is evaluated at each report of the merged axes
+  DateTime hourlyFirstReport(startDate, Time(0, 1, 0, 0));
+  TimeSeries hourly(hourlyFirstReport, Time(0, 1, 0, 0), createVector(std::vector<double>(8760, 10.0)), units);
+  series.push_back(hourly);
+  TimeSeries mixed = openstudio::sum(series);
+  ASSERT_EQ(35040u, mixed.values().size());
+  EXPECT_FALSE(mixed.intervalLength());
+  for (const DateTime& dateTime : {firstReportDateTime, hourlyFirstReport, DateTime(Date(MonthOfYear(MonthOfYear::Jun), 1), Time(0, 12, 45, 0))}) {
+    double expected = 0.0;
+    for (const TimeSeries& ts : series) {
+      expected += ts.value(dateTime);
+    }
+    EXPECT_DOUBLE_EQ(expected, mixed.value(dateTime)) << dateTime;
+  }
+
+  // units must match
+  series.emplace_back(firstReportDateTime, interval, createVector(std::vector<double>(10, 1.0)), "W");
+  EXPECT_TRUE(openstudio::sum(series).values().empty());
+}
+
 TEST_F(DataFixture, TimeSeries_Multiply8760) {
   // Test out mulitplication on a detailed series and an iterval series
   std::string units = "C";
@@ -6,6 +6,10 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <set>
+
 using namespace std;
 using namespace boost;
 
@@ -13,11 +17,10 @@ namespace openstudio {
 
 namespace detail {
 
-  TimeSeries_Impl::TimeSeries_Impl() : m_outOfRangeValue(0.0), m_wrapAround(false) {}
+  TimeSeries_Impl::TimeSeries_Impl() : m_firstIntervalSeconds(0), m_outOfRangeValue(0.0), m_wrapAround(false) {}
 
   TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+    : m_firstIntervalSeconds(intervalLength.totalSeconds()),
       m_values(values),
       m_units(units),
       m_intervalLength(intervalLength),
@@ -36,15 +39,10 @@ namespace detail {
 
     m_startDateTime = DateTime(startDate, Time(0));
 
-    for (size_t i = 0; i < values.size(); ++i) {
-      m_secondsFromFirstReport[i] = i * secondsPerInterval;
-      m_secondsFromStart[i] = (i + 1) * secondsPerInterval;
-    }
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
+    // the time axis is not stored, report i is at i * secondsPerInterval from the first report
     long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
+    if (!values.empty()) {
+      durationSeconds = static_cast<long>(values.size() - 1) * secondsPerInterval;
     }
 
     // check for wrap around
@@ -59,8 +57,7 @@ namespace detail {
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+    : m_firstIntervalSeconds(intervalLength.totalSeconds()),
       m_values(values),
       m_units(units),
       m_intervalLength(intervalLength),
@@ -78,15 +75,10 @@ namespace detail {
 
     m_startDateTime = m_firstReportDateTime - intervalLength;
 
-    for (size_t i = 0; i < values.size(); ++i) {
-      m_secondsFromFirstReport[i] = i * secondsPerInterval;
-      m_secondsFromStart[i] = (i + 1) * secondsPerInterval;
-    }
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
+    // the time axis is not stored, report i is at i * secondsPerInterval from the first report
     long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
+    if (!values.empty()) {
+      durationSeconds = static_cast<long>(values.size() - 1) * secondsPerInterval;
     }
 
     // check for wrap around
@@ -102,7 +94,7 @@ namespace detail {
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays, const Vector& values, const std::string& units)
     : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+      m_firstIntervalSeconds(0),
       m_values(values),
       m_units(units),
       m_outOfRangeValue(0.0),
@@ -130,10 +122,10 @@ namespace detail {
         LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in "
                   "the future.");
         m_startDateTime = DateTime(m_firstReportDateTime.date());
+        m_firstIntervalSeconds = firstIntervalSeconds;
 
         for (unsigned i = 0; i < values.size(); ++i) {
           m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
           if (i > 0) {
             if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -142,9 +134,9 @@ namespace detail {
         }
       } else {  // This is the new way
         m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+        m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+          m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
           if (i > 0) {
             if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -153,8 +145,6 @@ namespace detail {
         }
       }
 
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
       long durationSeconds = 0;
       if (!m_secondsFromFirstReport.empty()) {
         durationSeconds = m_secondsFromFirstReport.back();
@@ -175,7 +165,7 @@ namespace detail {
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays, const std::vector<double>& values,
                                    const std::string& units)
     : m_secondsFromFirstReport(timeInDays.size()),
-      m_secondsFromStart(values.size()),
+      m_firstIntervalSeconds(0),
       m_values(values.size()),
       m_units(units),
       m_outOfRangeValue(0.0),
@@ -204,10 +194,10 @@ namespace detail {
         LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in "
                   "the future.");
         m_startDateTime = DateTime(m_firstReportDateTime.date());
+        m_firstIntervalSeconds = firstIntervalSeconds;
 
         for (unsigned i = 0; i < values.size(); ++i) {
           m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
           if (i > 0) {
             if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -216,9 +206,9 @@ namespace detail {
         }
       } else {  // This is the new way
         m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+        m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+          m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
           if (i > 0) {
             if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -227,8 +217,6 @@ namespace detail {
         }
       }
 
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
       long durationSeconds = 0;
       if (!m_secondsFromFirstReport.empty()) {
         durationSeconds = m_secondsFromFirstReport.back();
@@ -248,7 +236,7 @@ namespace detail {
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector& values, const std::string& units)
     : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+      m_firstIntervalSeconds(0),
       m_values(values),
       m_units(units),
       m_outOfRangeValue(0.0),
@@ -290,7 +278,6 @@ namespace detail {
       // Compute the seconds from first report
       if (m_wrapAround) {
         m_secondsFromFirstReport[0] = 0;
-        m_secondsFromStart[0] = 0;
         int delta = 0;
         DateTime firstReportDateTimeWithYear =
           DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()),
@@ -306,19 +293,16 @@ namespace detail {
                        dateTimes[i].time());
           }
           m_secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
-          m_secondsFromStart[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
         }
       } else {
         m_secondsFromFirstReport[0] = 0;
-        m_secondsFromStart[0] = 0;
         for (unsigned i = 1; i < dateTimes.size(); i++) {
           m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
-          m_secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
         }
       }
 
       for (unsigned i = 1; i < dateTimes.size(); i++) {
-        if (m_secondsFromStart[i] < m_secondsFromStart[i - 1]) {
+        if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
           LOG_AND_THROW("Dates from first report must be monotonically increasing");
         }
       }
@@ -327,12 +311,12 @@ namespace detail {
       if (!extraTime) {
         int delta;
         bool foundInterval = false;
-        if (m_secondsFromStart.size() > 1) {
+        if (m_secondsFromFirstReport.size() > 1) {
           // check if all data is reported at a constant interval
-          delta = m_secondsFromStart[1] - m_secondsFromStart[0];
+          delta = m_secondsFromFirstReport[1] - m_secondsFromFirstReport[0];
           foundInterval = true;
-          for (unsigned i = 2; i < m_secondsFromStart.size(); i++) {
-            if (delta != m_secondsFromStart[i] - m_secondsFromStart[i - 1]) {
+          for (unsigned i = 2; i < m_secondsFromFirstReport.size(); i++) {
+            if (delta != m_secondsFromFirstReport[i] - m_secondsFromFirstReport[i - 1]) {
               foundInterval = false;
             }
             break;
@@ -353,22 +337,14 @@ namespace detail {
         }
       }
 
-      int firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
-
-      // Compute the seconds from start
-      m_secondsFromStart[0] = firstIntervalSeconds;
-      for (unsigned i = 1; i < dateTimes.size(); i++) {
-        m_secondsFromStart[i] = m_secondsFromStart[i] + firstIntervalSeconds;
-      }
-
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
+      m_firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
     }
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values,
                                    const std::string& units)
     : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
+      m_firstIntervalSeconds(0),
       m_values(values),
       m_units(units),
       m_outOfRangeValue(0.0),
@@ -396,17 +372,13 @@ namespace detail {
                   "the future.");
         m_startDateTime = DateTime(firstReportDateTime.date());
         m_firstReportDateTime = firstReportDateTime;
-        int firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
-        m_secondsFromStart = timeInSeconds;
-        for (unsigned i = 0; i < m_secondsFromStart.size(); i++) {
-          m_secondsFromStart[i] += firstIntervalSeconds;
-        }
+        m_firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
         m_secondsFromFirstReport = timeInSeconds;
 
       } else {  // This is the new behavior
         m_startDateTime = firstReportDateTime - Time(0, 0, 0, timeInSeconds[0]);
         m_firstReportDateTime = firstReportDateTime;
-        m_secondsFromStart = timeInSeconds;
+        m_firstIntervalSeconds = timeInSeconds[0];
 
         // Get rid of this later
         m_secondsFromFirstReport[0] = 0;
@@ -416,8 +388,6 @@ namespace detail {
       }
     }
 
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
     long durationSeconds = 0;
     if (!m_secondsFromFirstReport.empty()) {
       durationSeconds = m_secondsFromFirstReport.back();
@@ -440,18 +410,20 @@ namespace detail {
   }
 
   DateTimeVector TimeSeries_Impl::dateTimes() const {
-    DateTimeVector dateTimeObjs(m_secondsFromFirstReport.size());
-    for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-      dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, m_secondsFromFirstReport[i]);
+    std::size_t n = numReports();
+    DateTimeVector dateTimeObjs(n);
+    for (std::size_t i = 0; i < n; i++) {
+      dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, secondsFromFirstReportAt(i));
     }
     return dateTimeObjs;
   }
 
   /// time in days from end of the first reporting interval
   Vector TimeSeries_Impl::daysFromFirstReport() const {
-    Vector daysFromFirstReport(m_secondsFromFirstReport.size());
-    for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-      daysFromFirstReport[i] = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+    std::size_t n = numReports();
+    Vector daysFromFirstReport(n);
+    for (std::size_t i = 0; i < n; i++) {
+      daysFromFirstReport[i] = Time(0, 0, 0, secondsFromFirstReportAt(i)).totalDays();
     }
     return daysFromFirstReport;
   }
@@ -459,27 +431,48 @@ namespace detail {
   /// time in days from end of the first reporting interval at index i
   double TimeSeries_Impl::daysFromFirstReport(unsigned int i) const {
     double value = m_outOfRangeValue;
-    if (i < m_secondsFromFirstReport.size()) {
-      value = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+    if (i < numReports()) {
+      value = Time(0, 0, 0, secondsFromFirstReportAt(i)).totalDays();
     }
     return value;
   }
 
   /// time in seconds from end of the first reporting interval
   std::vector<long> TimeSeries_Impl::secondsFromFirstReport() const {
-    return m_secondsFromFirstReport;
+    if (!m_intervalLength) {
+      return m_secondsFromFirstReport;
+    }
+    std::vector<long> result(numReports());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+      result[i] = secondsFromFirstReportAt(i);
+    }
+    return result;
   }
 
   /// time in seconds from end of the first reporting interval at index i
   long TimeSeries_Impl::secondsFromFirstReport(unsigned int i) const {
     //double value = m_outOfRangeValue; // JWD: Shouldn't the out of range value be for values only?
     long value = 0;
-    if (i < m_secondsFromFirstReport.size()) {
-      value = m_secondsFromFirstReport[i];
+    if (i < numReports()) {
+      value = secondsFromFirstReportAt(i);
     }
     return value;
   }
 
+  std::size_t TimeSeries_Impl::numReports() const {
+    if (m_intervalLength) {
+      return m_values.size();
+    }
+    return m_secondsFromFirstReport.size();
+  }
+
+  long TimeSeries_Impl::secondsFromFirstReportAt(std::size_t i) const {
+    if (m_intervalLength) {
+      return static_cast<long>(i) * m_intervalLength->totalSeconds();
+    }
+    return m_secondsFromFirstReport[i];
+  }
+
   /// values
   Vector TimeSeries_Impl::values() const {
     return m_values;
@@ -513,12 +506,13 @@ namespace detail {
   double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstReport) const {
     double result = m_outOfRangeValue;
 
-    if (m_secondsFromFirstReport.empty()) {
+    std::size_t n = numReports();
+    if (n == 0) {
       LOG(Debug, "Cannot compute value because timeseries is empty");
       return result;
     }
 
-    long duration = m_secondsFromFirstReport.back();
+    long duration = secondsFromFirstReportAt(n - 1);
 
     if (m_intervalLength) {
 
@@ -564,8 +558,9 @@ namespace detail {
         LOG(Debug,
             "Cannot compute value " << secondsFromFirstReport << " seconds after first reporting time when duration is " << duration << " seconds");
       } else {
-        // normal interpolation
-        result = interp(m_secondsFromFirstReportAsVector, m_values, secondsFromFirstReport, HoldNextInterp, NoneExtrap);
+        // value of the first report at or after secondsFromFirstReport
+        std::size_t hint = 0;
+        result = valueAtSecondsFromFirstReport(secondsFromFirstReport, hint);
       }
     }
 
@@ -584,6 +579,15 @@ namespace detail {
 
   /// get value at date and time
   double TimeSeries_Impl::value(const DateTime& dateTime) const {
+    long secondsFromFirstReport = secondsFromFirstReportTo(dateTime);
+
+    LOG(Debug, "Initial: dateTime=" << dateTime << ", m_firstReportDateTime=" << m_firstReportDateTime << ", querying "
+                                    << secondsFromFirstReport << " seconds from first report");
+
+    return valueAtSecondsFromFirstReport(secondsFromFirstReport);
+  }
+
+  long TimeSeries_Impl::secondsFromFirstReportTo(const DateTime& dateTime) const {
     boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
 
     // If our timeseries doesn't have a year, we force it to the assumed one
@@ -614,10 +618,51 @@ namespace detail {
       }
     }
 
-    LOG(Debug, "Initial: dateTime=" << dateTime << ", m_firstReportDateTime=" << m_firstReportDateTime);
-    LOG(Debug, "Querying with dateTimeWithYear=" << dateTimeWithYear << ", firstReportDateTimeWithYear=" << firstReportDateTimeWithYear);
+    return (dateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
+  }
+
+  double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstReport, std::size_t& hint) const {
+    std::size_t n = numReports();
+    if (n == 0) {
+      return m_outOfRangeValue;
+    }
+    long duration = secondsFromFirstReportAt(n - 1);
+    if (secondsFromFirstReport > duration) {
+      return m_outOfRangeValue;
+    }
+
+    if (m_intervalLength) {
+      long secondsPerInterval = m_intervalLength->totalSeconds();
+      if (secondsFromFirstReport <= -secondsPerInterval) {
+        return m_outOfRangeValue;
+      }
+      if (secondsFromFirstReport <= 0) {
+        return m_values[0];
+      }
+      std::size_t index = (secondsFromFirstReport + secondsPerInterval - 1) / secondsPerInterval;
+      return m_values[std::min(index, n - 1)];
+    }
 
-    return value(dateTimeWithYear - firstReportDateTimeWithYear);
+    if (secondsFromFirstReport < 0) {
+      return m_outOfRangeValue;
+    }
+    // the first report at or after secondsFromFirstReport, as HoldNextInterp
+    if (secondsFromFirstReport == m_secondsFromFirstReport[0]) {
+      return m_values[0];
+    }
+    if (secondsFromFirstReport == duration) {
+      return m_values[n - 1];
+    }
+    // search unless walking forward from the previous report found is enough
+    if ((hint == 0) || (hint >= n) || (m_secondsFromFirstReport[hint - 1] >= secondsFromFirstReport)) {
+      hint = std::lower_bound(m_secondsFromFirstReport.begin(), m_secondsFromFirstReport.end(), secondsFromFirstReport)
+             - m_secondsFromFirstReport.begin();
+    } else {
+      while (m_secondsFromFirstReport[hint] < secondsFromFirstReport) {
+        ++hint;
+      }
+    }
+    return m_values[hint];
   }
 
   /// get values between start and end date times
@@ -670,12 +715,13 @@ namespace detail {
     double endSecondsFromFirstReport = (endDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
 
     unsigned numValues = m_values.size();
-    OS_ASSERT(numValues == m_secondsFromFirstReport.size());
+    OS_ASSERT(numValues == numReports());
 
     Vector result(numValues);
     unsigned resultSize = 0;
     for (unsigned i = 0; i < numValues; ++i) {
-      if ((m_secondsFromFirstReport[i] >= startSecondsFromFirstReport) && (m_secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
+      long seconds = secondsFromFirstReportAt(i);
+      if ((seconds >= startSecondsFromFirstReport) && (seconds <= endSecondsFromFirstReport)) {
         result[resultSize] = m_values[i];
         ++resultSize;
       }
@@ -702,80 +748,126 @@ namespace detail {
 
   /// add timeseries
   std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Impl& other) const {
-    std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
-
-    // if same units
-    if (m_units == other.units()) {
-
-      // make unique, ordered set of all date times
-      std::set<DateTime> dateTimesSet;
-      DateTimeVector dateTimes1 = dateTimes();
-      DateTimeVector dateTimes2 = other.dateTimes();
-      dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-      dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
-
-      // create vector out of set
-      DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
-
-      // compute value at each date time
-      Vector values(dateTimesSet.size());
-      unsigned valueIndex = 0;
-      for (const DateTime& dt : dateTimes) {
-        values[valueIndex] = value(dt) + other.value(dt);
-
-        LOG(Debug, "At '" << dt << "' " << value(dt) << " + " << other.value(dt) << " = " << values[valueIndex]);
-
-        ++valueIndex;
-      }
-
-      // make new result
-      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
-
-    } else {
+    if (m_units != other.units()) {
       LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
     }
-
-    return result;
+    return combine({this, &other}, {1.0, 1.0});
   }
 
   /// subtract timeseries
   std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Impl& other) const {
-    std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
-
-    // if same units
-    if (m_units == other.units()) {
+    if (m_units != other.units()) {
+      LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+    }
+    return combine({this, &other}, {1.0, -1.0});
+  }
 
-      // make unique, ordered set of all date times
-      std::set<DateTime> dateTimesSet;
-      DateTimeVector dateTimes1 = dateTimes();
-      DateTimeVector dateTimes2 = other.dateTimes();
-      dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-      dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::sum(const std::vector<const TimeSeries_Impl*>& series) {
+    OS_ASSERT(!series.empty());
+    return combine(series, std::vector<double>(series.size(), 1.0));
+  }
 
-      // create vector out of set
-      DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::combine(const std::vector<const TimeSeries_Impl*>& series, const std::vector<double>& factors) {
+    OS_ASSERT(!series.empty());
+    OS_ASSERT(series.size() == factors.size());
+    const TimeSeries_Impl& first = *series.front();
 
-      // compute value at each date time
-      Vector values(dateTimesSet.size());
-      unsigned valueIndex = 0;
-      for (const DateTime& dt : dateTimes) {
-        values[valueIndex] = value(dt) - other.value(dt);
+    bool sameAxis = true;
+    std::size_t numValues = 0;
+    for (const TimeSeries_Impl* s : series) {
+      sameAxis = sameAxis && first.sharesIntervalAxis(*s);
+      numValues = std::max(numValues, static_cast<std::size_t>(s->m_values.size()));
+    }
 
-        LOG(Debug, "At '" << dt << "' " << value(dt) << " - " << other.value(dt) << " = " << values[valueIndex]);
+    if (sameAxis) {
+      // all series report at the same times, combine the values index by index; series that are
+      // shorter than the result contribute their out of range value past their end
+      Vector values(numValues);
+      for (std::size_t i = 0; i < numValues; ++i) {
+        values[i] = 0.0;
+      }
+      if (numValues > 0) {
+        double* out = &values[0];
+        for (std::size_t k = 0; k < series.size(); ++k) {
+          const TimeSeries_Impl& s = *series[k];
+          const double factor = factors[k];
+          const std::size_t n = s.m_values.size();
+          if (n > 0) {
+            // plain loop over contiguous storage, the compiler vectorizes it
+            const double* in = &s.m_values[0];
+            for (std::size_t i = 0; i < n; ++i) {
+              out[i] += factor * in[i];
+            }
+          }
+          const double outOfRange = factor * s.m_outOfRangeValue;
+          for (std::size_t i = n; i < numValues; ++i) {
+            out[i] += outOfRange;
+          }
+        }
+      }
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(first.m_firstReportDateTime, *first.m_intervalLength, values, first.m_units));
+    }
 
-        ++valueIndex;
+    // evaluate every series at each report of any series, walking the merged time axis once per series
+    DateTimeVector dateTimes = mergedDateTimes(series);
+    Vector values(dateTimes.size());
+    for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+      values[i] = 0.0;
+    }
+    for (std::size_t k = 0; k < series.size(); ++k) {
+      const TimeSeries_Impl& s = *series[k];
+      const double factor = factors[k];
+      std::size_t hint = 0;
+      for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+        values[i] += factor * s.valueAtSecondsFromFirstReport(s.secondsFromFirstReportTo(dateTimes[i]), hint);
       }
+    }
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, first.m_units));
+  }
 
-      // make new result
-      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+  DateTimeVector TimeSeries_Impl::mergedDateTimes(const std::vector<const TimeSeries_Impl*>& series) {
+    std::vector<DateTimeVector> dateTimesBySeries;
+    dateTimesBySeries.reserve(series.size());
+    bool sorted = true;
+    for (const TimeSeries_Impl* s : series) {
+      dateTimesBySeries.push_back(s->dateTimes());
+      const DateTimeVector& dateTimes = dateTimesBySeries.back();
+      // wrap around series without a year may not be in increasing order
+      sorted = sorted && (std::adjacent_find(dateTimes.begin(), dateTimes.end(), [](const DateTime& a, const DateTime& b) { return !(a < b); })
+                          == dateTimes.end());
+    }
 
-    } else {
-      LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+    if (!sorted) {
+      std::set<DateTime> dateTimesSet;
+      for (const DateTimeVector& dateTimes : dateTimesBySeries) {
+        dateTimesSet.insert(dateTimes.begin(), dateTimes.end());
+      }
+      return {dateTimesSet.begin(), dateTimesSet.end()};
     }
 
+    // linear merge of the sorted axes, series that share the axis merged so far are skipped
+    DateTimeVector result = std::move(dateTimesBySeries.front());
+    DateTimeVector merged;
+    for (std::size_t k = 1; k < dateTimesBySeries.size(); ++k) {
+      const DateTimeVector& dateTimes = dateTimesBySeries[k];
+      if (dateTimes == result) {
+        continue;
+      }
+      merged.clear();
+      merged.reserve(result.size() + dateTimes.size());
+      std::set_union(result.begin(), result.end(), dateTimes.begin(), dateTimes.end(), std::back_inserter(merged));
+      result.swap(merged);
+    }
     return result;
   }
 
+  bool TimeSeries_Impl::sharesIntervalAxis(const TimeSeries_Impl& other) const {
+    return m_intervalLength && other.m_intervalLength && (m_intervalLength->totalSeconds() == other.m_intervalLength->totalSeconds())
+           && (m_firstReportDateTime == other.m_firstReportDateTime);
+  }
+
   std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator*(double d) const {
     if (m_intervalLength) {
       return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime, m_intervalLength.get(), m_values * d, m_units));
@@ -795,16 +887,18 @@ namespace detail {
       double lastTime = 0;
       // Use a Riemann sum to integrate under the curve
       for (unsigned i = 0; i < m_values.size(); i++) {
-        result += (m_secondsFromStart[i] - lastTime) * m_values[i];
-        lastTime = m_secondsFromStart[i];
+        long secondsFromStart = m_secondsFromFirstReport[i] + m_firstIntervalSeconds;
+        result += (secondsFromStart - lastTime) * m_values[i];
+        lastTime = secondsFromStart;
       }
     }
     return result;
   }
 
   double TimeSeries_Impl::averageValue() const {
-    if (!m_secondsFromStart.empty()) {
-      return integrate() / m_secondsFromStart.back();
+    std::size_t n = numReports();
+    if (n > 0) {
+      return integrate() / (secondsFromFirstReportAt(n - 1) + m_firstIntervalSeconds);
     }
     return 0;
   }
@@ -935,21 +1029,34 @@ TimeSeries operator*(double d, const TimeSeries& series) {
 }
 
 TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector) {
-  TimeSeries result;
-  bool first = true;
+  if (timeSeriesVector.empty()) {
+    return {};
+  }
+  if (timeSeriesVector.size() == 1) {
+    return timeSeriesVector.front();
+  }
+
+  std::vector<const detail::TimeSeries_Impl*> impls;
+  impls.reserve(timeSeriesVector.size());
+  const std::string units = timeSeriesVector.front().m_impl->units();
   for (const TimeSeries& ts : timeSeriesVector) {
-    if (first) {
-      result = ts;
-    } else {
-      result = result + ts;
-    }
-    if (result.values().empty()) {
-      LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the " << "units are incompatible.");
+    if (ts.m_impl->units() != units) {
+      LOG_FREE(Warn, "utilities.TimeSeries", "Adding timeseries with different units returns an empty timeseries");
+      impls.clear();
       break;
     }
-    first = false;
+    impls.push_back(ts.m_impl.get());
+  }
+
+  if (impls.empty() || timeSeriesVector.front().values().empty()) {
+    LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the " << "units are incompatible.");
+    if (impls.empty()) {
+      return {};
+    }
+    return timeSeriesVector.front();
   }
-  return result;
+
+  return {detail::TimeSeries_Impl::sum(impls)};
 }
 
 boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor() {
@@ -84,22 +84,50 @@ namespace detail {
 
     std::shared_ptr<TimeSeries_Impl> operator*(double d) const;
 
+    /** Returns the sum of all series, computed in a single pass. The series must not be empty and
+     *  must all have the same units. */
+    static std::shared_ptr<TimeSeries_Impl> sum(const std::vector<const TimeSeries_Impl*>& series);
+
     double integrate() const;
 
     double averageValue() const;
 
    private:
     REGISTER_LOGGER("utilities.TimeSeries_Impl");
+
+    // number of reports, whether or not the time axis is stored
+    std::size_t numReports() const;
+
+    // seconds from first report to report i, from the interval length or the stored time axis
+    long secondsFromFirstReportAt(std::size_t i) const;
+
+    // returns the sum of factors[i] * series[i], at each report of any of the series
+    static std::shared_ptr<TimeSeries_Impl> combine(const std::vector<const TimeSeries_Impl*>& series, const std::vector<double>& factors);
+
+    // ordered, unique date times of the reports of all series
+    static DateTimeVector mergedDateTimes(const std::vector<const TimeSeries_Impl*>& series);
+
+    // true if other has the same interval length and first report as this, so values can be combined index by index
+    bool sharesIntervalAxis(const TimeSeries_Impl& other) const;
+
+    // seconds from first report to dateTime, with the year assumptions described in value(const DateTime&)
+    long secondsFromFirstReportTo(const DateTime& dateTime) const;
+
+    // same as valueAtSecondsFromFirstReport without logging, hint is the index found by the previous call so that
+    // looking up increasing times is linear overall
+    double valueAtSecondsFromFirstReport(long secondsFromFirstReport, std::size_t& hint) const;
+
     // fully qualified first report date
     DateTime m_firstReportDateTime;
 
     // start date and time of time series
     DateTime m_startDateTime;
 
-    // integer seconds from first report date time, used for quick interpolation
+    // integer seconds from first report date time, only stored if there is no interval length
     std::vector<long> m_secondsFromFirstReport;
-    Vector m_secondsFromFirstReportAsVector;  // same as m_secondsFromFirstReport but stored as Vector
-    std::vector<long> m_secondsFromStart;
+
+    // seconds from start date and time to first report, adding it to m_secondsFromFirstReport gives seconds from start
+    long m_firstIntervalSeconds;
 
     // values reported at m_dateTimes
     Vector m_values;
@@ -107,7 +135,7 @@ namespace detail {
     // units of the values
     std::string m_units;
 
-    // length of the reporting interval if known, can be used to speed up interpolation
+    // length of the reporting interval if known, in which case report i is at i * m_intervalLength from the first report
     OptionalTime m_intervalLength;
 
     // value used for out of range data
@@ -282,6 +310,9 @@ class UTILITIES_API TimeSeries
   //@}
  private:
   REGISTER_LOGGER("utilities.TimeSeries");
+
+  friend UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
+
   // constructor from impl
   TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl);
 
@@ -302,7 +333,10 @@ UTILITIES_API TimeSeries operator*(double d, const TimeSeries& series);
 // We should be able to tackle double/TimeSeries after adding get/setQuantity to
 // IdfObject.
 
-// Helper function to add up all the TimeSeries in timeSeriesVector.
+/** Helper function to add up all the TimeSeries in timeSeriesVector. Series that share an interval
+ *  length and first report are added index by index, otherwise each series is evaluated at every
+ *  report date time of all series. Returns an empty TimeSeries if the first series is empty or if
+ *  the units differ. */
 UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
 
 /** Returns std::function pointer to sum(const std::vector<TimeSeries>&). */
@@ -13,23 +13,252 @@
 #include "../data/Vector.hpp"
 #include "../time/DateTime.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <string_view>
 
 #include <boost/regex.hpp>
 
 namespace openstudio {
 namespace detail {
 
+  namespace {
+
+    // Parsed files by path, so that loading an unchanged file again does not parse it again
+    class ParsedCSVFileCache
+    {
+     public:
+      std::shared_ptr<const ParsedCSVFile> get(const openstudio::path& p, std::time_t lastWriteTime, std::uintmax_t fileSize) {
+        std::string key = toString(openstudio::filesystem::system_complete(p));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+          if (it->key == key) {
+            if ((it->lastWriteTime != lastWriteTime) || (it->fileSize != fileSize)) {
+              m_entries.erase(it);
+              return nullptr;
+            }
+            // most recently used first
+            m_entries.splice(m_entries.begin(), m_entries, it);
+            return m_entries.front().parsed;
+          }
+        }
+        return nullptr;
+      }
+
+      void put(const openstudio::path& p, std::time_t lastWriteTime, std::uintmax_t fileSize, std::shared_ptr<const ParsedCSVFile> parsed) {
+        std::string key = toString(openstudio::filesystem::system_complete(p));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.remove_if([&key](const Entry& entry) { return entry.key == key; });
+        m_entries.push_front(Entry{key, lastWriteTime, fileSize, std::move(parsed)});
+        if (m_entries.size() > maxEntries) {
+          m_entries.pop_back();
+        }
+      }
+
+      void remove(const openstudio::path& p) {
+        std::string key = toString(openstudio::filesystem::system_complete(p));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.remove_if([&key](const Entry& entry) { return entry.key == key; });
+      }
+
+     private:
+      static constexpr std::size_t maxEntries = 16;
+
+      struct Entry
+      {
+        std::string key;
+        std::time_t lastWriteTime;
+        std::uintmax_t fileSize;
+        std::shared_ptr<const ParsedCSVFile> parsed;
+      };
+
+      std::mutex m_mutex;
+      std::list<Entry> m_entries;
+    };
+
+    ParsedCSVFileCache& parsedCSVFileCache() {
+      static ParsedCSVFileCache cache;
+      return cache;
+    }
+
+    std::size_t skipUnquoted(std::string_view line, std::size_t i) {
+      while ((i < line.size()) && (line[i] != ',') && (line[i] != '"')) {
+        ++i;
+      }
+      return i;
+    }
+
+    std::size_t skipToComma(std::string_view line, std::size_t i) {
+      while ((i < line.size()) && (line[i] != ',')) {
+        ++i;
+      }
+      return i;
+    }
+
+    // Tries to match a cell starting at position p of line, sets end and returns true on success.
+    // The alternatives are tried in the order of the Excel formatted CSV regex this replaces:
+    // \A[^,"]*(?=,)|(?:[^",]*"[^"]*"[^",]*)+|[^",]*"[^"]*\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\Z|\A[^,]*\Z
+    bool matchCell(std::string_view line, std::size_t p, bool allowEmpty, std::size_t& end) {
+      const std::size_t n = line.size();
+      const bool afterComma = (p > 0) && (line[p - 1] == ',');
+
+      // unquoted first cell
+      if (p == 0) {
+        std::size_t i = skipUnquoted(line, p);
+        if ((i < n) && (line[i] == ',') && (allowEmpty || (i > p))) {
+          end = i;
+          return true;
+        }
+      }
+
+      // one or more quoted sections, with unquoted text around them
+      std::size_t quotedEnd = std::string_view::npos;
+      for (std::size_t i = p;;) {
+        i = skipUnquoted(line, i);
+        if ((i == n) || (line[i] != '"')) {
+          break;
+        }
+        std::size_t closingQuote = line.find('"', i + 1);
+        if (closingQuote == std::string_view::npos) {
+          break;
+        }
+        i = skipUnquoted(line, closingQuote + 1);
+        quotedEnd = i;
+      }
+      if (quotedEnd != std::string_view::npos) {
+        end = quotedEnd;
+        return true;
+      }
+
+      // unterminated quote up to the end of the line
+      {
+        std::size_t i = skipUnquoted(line, p);
+        if ((i < n) && (line[i] == '"') && (line.find('"', i + 1) == std::string_view::npos)) {
+          end = n;
+          return true;
+        }
+      }
+
+      // any cell after a comma
+      if (afterComma) {
+        std::size_t i = skipToComma(line, p);
+        if (allowEmpty || (i > p)) {
+          end = i;
+          return true;
+        }
+      }
+
+      // line without a comma
+      if ((p == 0) && (line.find(',') == std::string_view::npos) && (allowEmpty || (n > 0))) {
+        end = n;
+        return true;
+      }
+
+      return false;
+    }
+
+    // Splits line into cells the way boost::regex_token_iterator did with the regex above: cells are searched for one after
+    // the other, and an empty cell cannot be found at the position where the previous empty cell was found
+    void splitLine(std::string_view line, std::vector<std::string_view>& cells) {
+      cells.clear();
+      std::size_t pos = 0;
+      bool lastEmpty = false;
+      while (pos <= line.size()) {
+        bool found = false;
+        for (std::size_t p = pos; p <= line.size(); ++p) {
+          std::size_t end = 0;
+          if (matchCell(line, p, !(lastEmpty && (p == pos)), end)) {
+            cells.push_back(line.substr(p, end - p));
+            lastEmpty = (end == p);
+            pos = end;
+            found = true;
+            break;
+          }
+        }
+        if (!found) {
+          break;
+        }
+      }
+    }
+
+    // ^[-0-9]+$
+    bool isIntegerCell(std::string_view cell) {
+      return !cell.empty() && std::all_of(cell.begin(), cell.end(), [](char c) { return (c == '-') || ((c >= '0') && (c <= '9')); });
+    }
+
+    // ^[+-]?\d+\.?(\d+)?$
+    bool isDoubleCell(std::string_view cell) {
+      std::size_t i = 0;
+      if ((i < cell.size()) && ((cell[i] == '+') || (cell[i] == '-'))) {
+        ++i;
+      }
+      std::size_t digitsBegin = i;
+      while ((i < cell.size()) && (cell[i] >= '0') && (cell[i] <= '9')) {
+        ++i;
+      }
+      if (i == digitsBegin) {
+        return false;
+      }
+      if ((i < cell.size()) && (cell[i] == '.')) {
+        ++i;
+      }
+      while ((i < cell.size()) && (cell[i] >= '0') && (cell[i] <= '9')) {
+        ++i;
+      }
+      return i == cell.size();
+    }
+
+    bool isLineSeparator(char c) {
+      return (c == '\n') || (c == '\r') || (c == '\f');
+    }
+
+    // searches for ^"(.*)"$, where ^ and $ also match after and before a line separator
+    bool unquoteCell(std::string_view cell, std::string_view& result) {
+      for (std::size_t i = 0; i < cell.size(); ++i) {
+        if ((cell[i] != '"') || ((i > 0) && !isLineSeparator(cell[i - 1]))) {
+          continue;
+        }
+        for (std::size_t j = cell.size() - 1; j > i; --j) {
+          if ((cell[j] == '"') && ((j + 1 == cell.size()) || isLineSeparator(cell[j + 1]))) {
+            result = cell.substr(i + 1, j - i - 1);
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    void appendStringCell(ParsedCSVFile::Column& column, std::string value) {
+      column.types.push_back(ParsedCSVFile::String);
+      column.numbers.push_back(0.0);
+      column.strings.push_back(std::move(value));
+    }
+
+    Variant cellAsVariant(const ParsedCSVFile::Column& column, unsigned row, std::size_t& stringIndex) {
+      switch (column.types[row]) {
+        case ParsedCSVFile::Integer:
+          return Variant(static_cast<int>(column.numbers[row]));
+        case ParsedCSVFile::Double:
+          return Variant(column.numbers[row]);
+        default:
+          return Variant(column.strings[stringIndex++]);
+      }
+    }
+
+  }  // namespace
+
   CSVFile_Impl::CSVFile_Impl() : m_numColumns(0) {}
 
   CSVFile_Impl::CSVFile_Impl(const std::string& s) {
-    std::istringstream ss(s);
-
     // will throw on error
-    m_rows = parseRows(ss);
+    m_parsed = parse(s);
 
-    assignNumColumns();
-    padRows();
+    m_numColumns = m_parsed->columns.size();
   }
 
   CSVFile_Impl::CSVFile_Impl(const openstudio::path& p) {
@@ -37,15 +266,22 @@ namespace detail {
       LOG_AND_THROW("Path '" << p << "' is not a CSVFile file");
     }
 
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(p));
-
-    // will throw on error
-    m_rows = parseRows(ifs);
+    // stamp the file before reading it, a change made while it is read invalidates the cache entry
+    std::time_t lastWriteTime = openstudio::filesystem::last_write_time(p);
+    std::uintmax_t fileSize = openstudio::filesystem::file_size(p);
+    m_parsed = parsedCSVFileCache().get(p, lastWriteTime, fileSize);
+    if (!m_parsed) {
+      // open file
+      std::ifstream ifs(openstudio::toSystemFilename(p));
+      std::string text((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+      // will throw on error
+      m_parsed = parse(text);
+      parsedCSVFileCache().put(p, lastWriteTime, fileSize, m_parsed);
+    }
 
     m_path = p;
-    assignNumColumns();
-    padRows();
+    m_numColumns = m_parsed->columns.size();
   }
 
   CSVFile CSVFile_Impl::clone() const {
@@ -60,9 +296,15 @@ namespace detail {
   std::string CSVFile_Impl::string() const {
     static const boost::regex escapeItRegex(",");
 
+    std::vector<std::vector<Variant>> parsedRows;
+    if (m_parsed) {
+      parsedRows = rows();
+    }
+    const std::vector<std::vector<Variant>>& allRows = m_parsed ? parsedRows : m_rows;
+
     std::string s;
     std::stringstream result;
-    for (const auto& row : m_rows) {
+    for (const auto& row : allRows) {
       OS_ASSERT(row.size() == m_numColumns);
       for (size_t i = 0; i < m_numColumns; ++i) {
 
@@ -107,6 +349,7 @@ namespace detail {
         try {
           outFile << string();
           outFile.close();
+          parsedCSVFileCache().remove(*p);
           return true;
         } catch (...) {
           LOG(Error, "Unable to write file to path '" << toString(*p) << "'.");
@@ -143,14 +386,32 @@ namespace detail {
   }
 
   unsigned CSVFile_Impl::numRows() const {
+    if (m_parsed) {
+      return m_parsed->numRows;
+    }
     return m_rows.size();
   }
 
   std::vector<std::vector<Variant>> CSVFile_Impl::rows() const {
-    return m_rows;
+    if (!m_parsed) {
+      return m_rows;
+    }
+
+    std::vector<std::vector<Variant>> result(m_parsed->numRows);
+    for (auto& row : result) {
+      row.reserve(m_numColumns);
+    }
+    for (const auto& column : m_parsed->columns) {
+      std::size_t stringIndex = 0;
+      for (unsigned i = 0; i < m_parsed->numRows; ++i) {
+        result[i].push_back(cellAsVariant(column, i, stringIndex));
+      }
+    }
+    return result;
   }
 
   void CSVFile_Impl::addRow(const std::vector<Variant>& row) {
+    materializeRows();
     m_rows.push_back(row);
     if (row.size() > m_numColumns) {
       m_numColumns = row.size();
@@ -163,11 +424,13 @@ namespace detail {
   }
 
   void CSVFile_Impl::setRows(const std::vector<std::vector<Variant>>& rows) {
+    m_parsed.reset();
     m_rows = rows;
     assignNumColumns();
   }
 
   void CSVFile_Impl::clear() {
+    m_parsed.reset();
     m_rows.clear();
     m_path.reset();
     m_numColumns = 0;
@@ -249,6 +512,24 @@ namespace detail {
 
     std::vector<DateTime> result;
 
+    if (m_parsed) {
+      const ParsedCSVFile::Column& column = m_parsed->columns[columnIndex];
+      result.reserve(m_parsed->numRows);
+      std::size_t stringIndex = 0;
+      for (unsigned i = 0; i < m_parsed->numRows; ++i) {
+        boost::optional<DateTime> dateTime;
+        if (column.types[i] == ParsedCSVFile::String) {
+          dateTime = DateTime::fromISO8601(column.strings[stringIndex++]);
+        }
+        if (!dateTime) {
+          LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
+          return {};
+        }
+        result.push_back(*dateTime);
+      }
+      return result;
+    }
+
     unsigned numRows = m_rows.size();
     for (unsigned i = 0; i < numRows; ++i) {
       if (m_rows[i][columnIndex].variantType() != VariantType::String) {
@@ -273,6 +554,16 @@ namespace detail {
       return {};
     }
 
+    if (m_parsed) {
+      const ParsedCSVFile::Column& column = m_parsed->columns[columnIndex];
+      auto it = std::find(column.types.begin(), column.types.end(), ParsedCSVFile::String);
+      if (it != column.types.end()) {
+        LOG(Warn, "Value at row " << (it - column.types.begin()) << " and column " << columnIndex << " is not a numeric value");
+        return {};
+      }
+      return column.numbers;
+    }
+
     std::vector<double> result;
 
     unsigned numRows = m_rows.size();
@@ -303,6 +594,26 @@ namespace detail {
 
     std::vector<std::string> result;
 
+    if (m_parsed) {
+      const ParsedCSVFile::Column& column = m_parsed->columns[columnIndex];
+      result.reserve(m_parsed->numRows);
+      std::size_t stringIndex = 0;
+      for (unsigned i = 0; i < m_parsed->numRows; ++i) {
+        if (column.types[i] == ParsedCSVFile::String) {
+          result.push_back(column.strings[stringIndex++]);
+        } else {
+          std::stringstream ss;
+          if (column.types[i] == ParsedCSVFile::Integer) {
+            ss << static_cast<int>(column.numbers[i]);
+          } else {
+            ss << column.numbers[i];
+          }
+          result.push_back(ss.str());
+        }
+      }
+      return result;
+    }
+
     unsigned numRows = m_rows.size();
     for (unsigned i = 0; i < numRows; ++i) {
 
@@ -323,45 +634,62 @@ namespace detail {
   }
 
   // throws on error
-  std::vector<std::vector<Variant>> CSVFile_Impl::parseRows(std::istream& input) {
-    std::vector<std::vector<Variant>> result;
+  std::shared_ptr<const ParsedCSVFile> CSVFile_Impl::parse(const std::string& text) {
+    auto result = std::make_shared<ParsedCSVFile>();
 
     // DLM: what conditions should make this throw?
 
-    // Excel formated CSV regex, \A[^,"]*(?=,)|(?:[^",]*"[^"]*"[^",]*)+|[^",]*"[^"]*\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\Z|\A[^,]*\Z
-    static const boost::regex csvRegex(
-      "\\A[^,\"]*(?=,)|(?:[^\",]*\"[^\"]*\"[^\",]*)+|[^\",]*\"[^\"]*\\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\\Z|\\A[^,]*\\Z");
-    static const boost::regex intRegex("^[-0-9]+$");
-    static const boost::regex doubleRegex("^[+-]?\\d+\\.?(\\d+)?$");
-    static const boost::regex quoteRegex("^\"(.*)\"$");
-
-    std::string line;
-    while (std::getline(input, line)) {
-      std::vector<Variant> row;
-      boost::regex_token_iterator<std::string::iterator> it{line.begin(), line.end(), csvRegex, 0};
-      boost::regex_token_iterator<std::string::iterator> end;
-      while (it != end) {
-        std::string value = *it;
-        if (boost::regex_match(value, intRegex)) {
-          row.push_back(Variant(std::stoi(value)));
-        } else if (boost::regex_match(value, doubleRegex)) {
-          row.push_back(Variant(std::stod(value)));
-        } else {
-          boost::smatch valueMatch;
-          if (boost::regex_search(value, valueMatch, quoteRegex)) {
-            row.push_back(Variant(valueMatch[1]));
-          } else {
-            row.push_back(Variant(value));
+    std::vector<std::string_view> cells;
+    std::string_view remaining(text);
+    while (!remaining.empty()) {
+      // lines as std::getline would read them
+      std::size_t lineEnd = remaining.find('\n');
+      std::string_view line = remaining.substr(0, lineEnd);
+      remaining.remove_prefix((lineEnd == std::string_view::npos) ? remaining.size() : lineEnd + 1);
+
+      splitLine(line, cells);
+
+      const unsigned row = result->numRows;
+      for (std::size_t c = 0; c < cells.size(); ++c) {
+        if (c == result->columns.size()) {
+          // new column, padded for the previous rows
+          ParsedCSVFile::Column& column = result->columns.emplace_back();
+          for (unsigned i = 0; i < row; ++i) {
+            appendStringCell(column, "");
           }
         }
-        ++it;
+        ParsedCSVFile::Column& column = result->columns[c];
+
+        std::string_view cell = cells[c];
+        std::string_view unquoted;
+        if (isIntegerCell(cell)) {
+          column.types.push_back(ParsedCSVFile::Integer);
+          column.numbers.push_back(std::stoi(std::string(cell)));
+        } else if (isDoubleCell(cell)) {
+          column.types.push_back(ParsedCSVFile::Double);
+          column.numbers.push_back(std::stod(std::string(cell)));
+        } else if (unquoteCell(cell, unquoted)) {
+          appendStringCell(column, std::string(unquoted));
+        } else {
+          appendStringCell(column, std::string(cell));
+        }
       }
-      result.push_back(row);
+      for (std::size_t c = cells.size(); c < result->columns.size(); ++c) {
+        appendStringCell(result->columns[c], "");
+      }
+      ++result->numRows;
     }
 
     return result;
   }
 
+  void CSVFile_Impl::materializeRows() {
+    if (m_parsed) {
+      m_rows = rows();
+      m_parsed.reset();
+    }
+  }
+
   void CSVFile_Impl::assignNumColumns() {
     m_numColumns = 0;
     for (const auto& row : m_rows) {
@@ -370,6 +698,8 @@ namespace detail {
   }
 
   void CSVFile_Impl::ensureNumRows(unsigned numRows) {
+    materializeRows();
+
     // add empty cells to existing columns if needed
     if (numRows > m_rows.size()) {
       unsigned numRowsToAdd = numRows - m_rows.size();
@@ -32,7 +32,8 @@ class UTILITIES_API CSVFile
   /** Constructor with string, will throw if string is not a CSVFile. */
   CSVFile(const std::string& s);
 
-  /** Constructor with path, will throw if path does not exist or file is incorrect. */
+  /** Constructor with path, will throw if path does not exist or file is incorrect. The parsed content of recently
+   *  loaded files is shared, a file is only parsed again once its size or modification time changes. */
   CSVFile(const openstudio::path& p);
 
   /** Clones this CSVFile into a separate one. */
@@ -12,6 +12,10 @@
 #include "../core/Path.hpp"
 #include "../data/Vector.hpp"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace openstudio {
 
 class CSVFile;
@@ -20,6 +24,31 @@ class DateTime;
 
 namespace detail {
 
+  /** Cells of a parsed CSV file, stored by column. Numeric cells are kept as numbers, without going through Variant.
+   *  Rows shorter than the longest row are padded with empty string cells. */
+  struct UTILITIES_API ParsedCSVFile
+  {
+    enum CellType : unsigned char
+    {
+      Integer,
+      Double,
+      String
+    };
+
+    struct Column
+    {
+      // type of each cell
+      std::vector<CellType> types;
+      // value of each numeric cell, 0 for string cells
+      std::vector<double> numbers;
+      // values of the string cells, in row order
+      std::vector<std::string> strings;
+    };
+
+    unsigned numRows = 0;
+    std::vector<Column> columns;
+  };
+
   class UTILITIES_API CSVFile_Impl
   {
    public:
@@ -81,7 +110,10 @@ namespace detail {
     REGISTER_LOGGER("openstudio.CSVFile");
 
     // throws on error
-    static std::vector<std::vector<Variant>> parseRows(std::istream& input);
+    static std::shared_ptr<const ParsedCSVFile> parse(const std::string& text);
+
+    // fills m_rows from m_parsed before the rows are modified
+    void materializeRows();
 
     void assignNumColumns();
 
@@ -92,6 +124,8 @@ namespace detail {
     boost::optional<openstudio::path> m_path;
     unsigned m_numColumns;
     std::vector<std::vector<Variant>> m_rows;
+    // set until the rows are needed as Variants, can be shared with the other CSVFiles loaded from the same file
+    std::shared_ptr<const ParsedCSVFile> m_parsed;
   };
 
 }  // namespace detail
@@ -11,8 +11,17 @@
 #include "../core/StringHelpers.hpp"
 #include "../core/Assert.hpp"
 
+#include <boost/algorithm/string/join.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
 #include <fmt/format.h>
+#include <algorithm>
+#include <cerrno>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 
 namespace openstudio {
 
@@ -1042,7 +1051,7 @@ std::string EpwDataPoint::getUnits(EpwComputedField field) {
   return string;
 }
 
-boost::optional<double> EpwDataPoint::getFieldByName(const std::string& name) {
+boost::optional<double> EpwDataPoint::getFieldByName(const std::string& name) const {
   EpwDataField id;
   try {
     id = EpwDataField(name);
@@ -1053,7 +1062,7 @@ boost::optional<double> EpwDataPoint::getFieldByName(const std::string& name) {
   return getField(id);
 }
 
-boost::optional<double> EpwDataPoint::getField(EpwDataField id) {
+boost::optional<double> EpwDataPoint::getField(EpwDataField id) const {
   boost::optional<int> ivalue;
   switch (id.value()) {
     case EpwDataField::DryBulbTemperature:
@@ -1439,28 +1448,28 @@ boost::optional<std::string> EpwDataPoint::toWthString() const {
 }
 
 // Local convenience functions
+// These use the C conversion functions directly rather than std::stoi/std::stod, so that the empty or non-numeric
+// fields that are common in EPW files do not go through an exception. The accepted input is the same.
 static int stringToInteger(const std::string& string, bool* ok) {
-  int value = 0;
-  *ok = true;
-  try {
-    value = std::stoi(string);
-  } catch (const std::invalid_argument&) {
-    *ok = false;
-  } catch (const std::out_of_range&) {
-    *ok = false;
+  const char* begin = string.c_str();
+  char* end = nullptr;
+  errno = 0;
+  long value = std::strtol(begin, &end, 10);
+  *ok = (end != begin) && (errno != ERANGE) && (value >= std::numeric_limits<int>::min()) && (value <= std::numeric_limits<int>::max());
+  if (!*ok) {
+    return 0;
   }
-  return value;
+  return static_cast<int>(value);
 }
 
 static double stringToDouble(const std::string& string, bool* ok) {
-  double value = 0;
-  *ok = true;
-  try {
-    value = std::stod(string);
-  } catch (const std::invalid_argument&) {
-    *ok = false;
-  } catch (const std::out_of_range&) {
-    *ok = false;
+  const char* begin = string.c_str();
+  char* end = nullptr;
+  errno = 0;
+  double value = std::strtod(begin, &end);
+  *ok = (end != begin) && (errno != ERANGE);
+  if (!*ok) {
+    return 0;
   }
   return value;
 }
@@ -2337,45 +2346,42 @@ bool EpwDataPoint::setLiquidPrecipitationQuantity(const std::string& liquidPreci
   return true;
 }
 
-boost::optional<AirState> EpwDataPoint::airState() const {
-  boost::optional<double> value = dryBulbTemperature();
-  if (!value) {
+// Shared by EpwDataPoint and the columnar data of EpwFile
+static boost::optional<AirState> airStateFromFields(const boost::optional<double>& drybulb, const boost::optional<double>& pressure,
+                                                    const boost::optional<double>& relativeHumidity, const boost::optional<double>& dewpoint) {
+  if (!drybulb) {
     return boost::none;  // Have to have dry bulb
   }
-  double drybulb = value.get();
-
-  value = atmosphericStationPressure();
-  if (!value) {
+  if (!pressure) {
     return boost::none;  // Have to have pressure
   }
-  double pressure = value.get();
-
-  value = relativeHumidity();
-  if (!value) {  // Don't have relative humidity
-    value = dewPointTemperature();
-    if (value) {
-      double dewpoint = value.get();
-      return AirState::fromDryBulbDewPointPressure(drybulb, dewpoint, pressure);
+  if (!relativeHumidity) {  // Don't have relative humidity
+    if (dewpoint) {
+      return AirState::fromDryBulbDewPointPressure(drybulb.get(), dewpoint.get(), pressure.get());
     }
   } else {  // Have relative humidity
-    double RH = value.get();
-    return AirState::fromDryBulbRelativeHumidityPressure(drybulb, RH, pressure);
+    return AirState::fromDryBulbRelativeHumidityPressure(drybulb.get(), relativeHumidity.get(), pressure.get());
   }
-
   return boost::none;
 }
 
-boost::optional<double> EpwDataPoint::saturationPressure() const {
-  boost::optional<double> optdrybulb = dryBulbTemperature();
-  if (optdrybulb) {
-    double drybulb = optdrybulb.get();
-    if (drybulb >= -100.0 && drybulb <= 200.0) {
-      return boost::optional<double>(openstudio::psat(drybulb));
+static boost::optional<double> saturationPressureFromDryBulb(const boost::optional<double>& drybulb) {
+  if (drybulb) {
+    if (drybulb.get() >= -100.0 && drybulb.get() <= 200.0) {
+      return boost::optional<double>(openstudio::psat(drybulb.get()));
     }
   }
   return boost::none;
 }
 
+boost::optional<AirState> EpwDataPoint::airState() const {
+  return airStateFromFields(dryBulbTemperature(), atmosphericStationPressure(), relativeHumidity(), dewPointTemperature());
+}
+
+boost::optional<double> EpwDataPoint::saturationPressure() const {
+  return saturationPressureFromDryBulb(dryBulbTemperature());
+}
+
 boost::optional<double> EpwDataPoint::enthalpy() const {
   boost::optional<AirState> state = airState();
   if (state) {
@@ -2440,6 +2446,15 @@ EpwFile::EpwFile() : m_latitude(0), m_longitude(0), m_timeZone(0), m_elevation(0
 boost::optional<EpwFile> EpwFile::load(const openstudio::path& p, bool storeData) {
   boost::optional<EpwFile> result;
   try {
+    openstudio::path cachePath = binaryCachePath(p);
+    if (openstudio::filesystem::is_regular_file(p) && openstudio::filesystem::is_regular_file(cachePath)) {
+      EpwFile epwFile;
+      epwFile.m_path = p;
+      epwFile.m_checksum = openstudio::checksum(p);
+      if (epwFile.loadBinaryCache(cachePath, storeData)) {
+        return epwFile;
+      }
+    }
     result = EpwFile(p, storeData);
   } catch (const std::exception&) {
   }
@@ -2531,6 +2546,9 @@ boost::optional<int> EpwFile::endDateActualYear() const {
 }
 
 std::vector<EpwDataPoint> EpwFile::data() {
+  if (m_data.empty() && !m_cachedRecords.empty()) {
+    parseCachedRecords();
+  }
   if (m_data.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
@@ -4295,7 +4313,7 @@ std::vector<EpwGroundTemperatureDepth> EpwFile::groundTemperatureDepths() {
 }
 
 boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
-  if (m_data.empty()) {
+  if (m_columns.dateTimes.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
@@ -4320,36 +4338,39 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
     LOG(Warn, "Unrecognized EPW data field '" << name << "'");
     return boost::none;
   }
-  if (!m_data.empty()) {
-    std::string units = EpwDataPoint::getUnits(id);
-    DateTimeVector dates;
-    dates.push_back(DateTime());  // Use a placeholder to avoid an insert
-    std::vector<double> values;
-    for (unsigned int i = 0; i < m_data.size(); i++) {
-      DateTime dateTime = m_data[i].dateTime();
-      // Time time=m_data[i].time();
-      boost::optional<double> value = m_data[i].getField(id);
-      if (value) {
-        if (isActual()) {
-          dates.push_back(DateTime(dateTime));
-        } else {
-          // Strip year
-          dates.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
+  if (!m_columns.dateTimes.empty() && !m_columns.values[id.value()].empty()) {
+    const DateTimeVector& dateTimes = timeSeriesDateTimes();
+    const std::vector<double>& column = m_columns.values[id.value()];
+    const std::vector<bool>& missing = m_columns.missing[id.value()];
+    std::size_t numValues = column.size() - m_columns.numMissing[id.value()];
+    if (numValues > 0) {
+      std::string units = EpwDataPoint::getUnits(id);
+      DateTimeVector dates;
+      dates.reserve(numValues + 1);
+      dates.push_back(DateTime());  // Use a placeholder to avoid an insert
+      Vector values(numValues);
+      if (numValues == column.size()) {
+        dates.insert(dates.end(), dateTimes.begin(), dateTimes.end());
+        std::copy(column.begin(), column.end(), values.begin());
+      } else {
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < column.size(); ++i) {
+          if (!missing[i]) {
+            dates.push_back(dateTimes[i]);
+            values[j++] = column[i];
+          }
         }
-        values.push_back(value.get());
       }
-    }
-    if (!values.empty()) {
       DateTime start = dates[1] - Time(0, 0, 0, 3600 / m_recordsPerHour);
       dates[0] = start;  // Overwrite the placeholder
-      return boost::optional<TimeSeries>(TimeSeries(dates, openstudio::createVector(values), units));
+      return boost::optional<TimeSeries>(TimeSeries(dates, values, units));
     }
   }
   return boost::none;
 }
 
 boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& name) {
-  if (m_data.empty()) {
+  if (m_columns.dateTimes.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
@@ -4376,38 +4397,56 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& na
   }
 
   std::string units = EpwDataPoint::getUnits(id);
-  boost::optional<double> (EpwDataPoint::*compute)() const;
+  double (AirState::*compute)() const = nullptr;
   switch (id.value()) {
     case EpwComputedField::SaturationPressure:
-      compute = &EpwDataPoint::saturationPressure;
       break;
     case EpwComputedField::Enthalpy:
-      compute = &EpwDataPoint::enthalpy;
+      compute = &AirState::enthalpy;
       break;
     case EpwComputedField::HumidityRatio:
-      compute = &EpwDataPoint::humidityRatio;
+      compute = &AirState::humidityRatio;
       break;
     case EpwComputedField::WetBulbTemperature:
-      compute = &EpwDataPoint::wetbulb;
+      compute = &AirState::wetbulb;
       break;
     case EpwComputedField::Density:
-      compute = &EpwDataPoint::density;
+      compute = &AirState::density;
       break;
     case EpwComputedField::SpecificVolume:
-      compute = &EpwDataPoint::specificVolume;
+      compute = &AirState::specificVolume;
       break;
     default:
       return boost::none;
   }
+  if (m_columns.dateTimes.empty()) {
+    return boost::none;
+  }
+  auto field = [this](EpwDataField::domain field, std::size_t i) -> boost::optional<double> {
+    if (m_columns.missing[field][i]) {
+      return boost::none;
+    }
+    return m_columns.values[field][i];
+  };
+  // Use the same time axis as getTimeSeries, the years of TMY data are not in order
+  const DateTimeVector& dateTimes = timeSeriesDateTimes();
   DateTimeVector dates;
   dates.push_back(DateTime());  // Use a placeholder to avoid an insert
   std::vector<double> values;
-  for (unsigned int i = 0; i < m_data.size(); i++) {
-    Date date = m_data[i].date();
-    Time time = m_data[i].time();
-    boost::optional<double> value = (m_data[i].*compute)();
+  for (std::size_t i = 0; i < dateTimes.size(); i++) {
+    boost::optional<double> value;
+    if (compute) {
+      boost::optional<AirState> state =
+        airStateFromFields(field(EpwDataField::DryBulbTemperature, i), field(EpwDataField::AtmosphericStationPressure, i),
+                           field(EpwDataField::RelativeHumidity, i), field(EpwDataField::DewPointTemperature, i));
+      if (state) {
+        value = (state.get().*compute)();
+      }
+    } else {
+      value = saturationPressureFromDryBulb(field(EpwDataField::DryBulbTemperature, i));
+    }
     if (value) {
-      dates.push_back(DateTime(date, time));
+      dates.push_back(dateTimes[i]);
       values.push_back(value.get());
     }
   }
@@ -4419,8 +4458,51 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& na
   return boost::none;
 }
 
+const DateTimeVector& EpwFile::timeSeriesDateTimes() {
+  if (m_columns.timeSeriesDateTimes.empty()) {
+    DateTimeVector dateTimes;
+    dateTimes.reserve(m_columns.dateTimes.size());
+    for (const DateTime& dateTime : m_columns.dateTimes) {
+      if (isActual()) {
+        dateTimes.push_back(dateTime);
+      } else {
+        // Strip year
+        dateTimes.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
+      }
+    }
+    m_columns.timeSeriesDateTimes = std::move(dateTimes);
+  }
+  return m_columns.timeSeriesDateTimes;
+}
+
+void EpwFile::appendToColumns(const EpwDataPoint& pt) {
+  if (m_columns.values.empty()) {
+    std::size_t numFields = EpwDataField::getValues().size();
+    m_columns.values.resize(numFields);
+    m_columns.missing.resize(numFields);
+    m_columns.numMissing.assign(numFields, 0);
+  }
+  static const std::vector<EpwDataField> numericFields = [] {
+    std::vector<EpwDataField> fields;
+    for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+      fields.emplace_back(field);
+    }
+    return fields;
+  }();
+  m_columns.dateTimes.push_back(pt.dateTime());
+  for (const EpwDataField& id : numericFields) {
+    int field = id.value();
+    boost::optional<double> value = pt.getField(id);
+    m_columns.values[field].push_back(value ? value.get() : 0.0);
+    m_columns.missing[field].push_back(!value);
+    if (!value) {
+      ++m_columns.numMissing[field];
+    }
+  }
+}
+
 bool EpwFile::translateToWth(openstudio::path path, std::string description) {
-  if (m_data.empty()) {
+  if (m_data.empty() && m_cachedRecords.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
@@ -4507,12 +4589,277 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
   return true;
 }
 
+// Binary cache layout, all values in native byte order:
+//   magic, version, byte order mark
+//   checksum and size of the EPW file the cache was written for
+//   header lines, as read from the EPW file
+//   isActual, minutesMatch, actual years of the start and end dates (0 if none)
+//   number of records, then year, month, day, hour and minute of each record as int32 columns
+//   one double column and one missing flag column per numeric EpwDataField
+//   the data records, one per line, from EpwDataPoint::toEpwStrings
+static constexpr char binaryCacheMagic[8] = {'O', 'S', 'E', 'P', 'W', 'B', 'I', 'N'};
+static constexpr std::uint32_t binaryCacheVersion = 1;
+static constexpr std::uint32_t binaryCacheByteOrderMark = 0x01020304;
+
+template <typename T>
+static void writeBinary(std::ostream& os, const T& value) {
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static void writeBinary(std::ostream& os, const std::string& value) {
+  writeBinary(os, static_cast<std::uint64_t>(value.size()));
+  os.write(value.data(), value.size());
+}
+
+// Reads the values written by writeBinary from a buffer, every read fails once the end of the buffer is reached
+struct BinaryCacheReader
+{
+  const char* pos;
+  const char* end;
+
+  bool read(void* dest, std::size_t size) {
+    if (static_cast<std::size_t>(end - pos) < size) {
+      pos = end;
+      return false;
+    }
+    std::memcpy(dest, pos, size);
+    pos += size;
+    return true;
+  }
+
+  template <typename T>
+  bool read(T& value) {
+    return read(&value, sizeof(T));
+  }
+
+  bool read(std::string& value) {
+    std::uint64_t size = 0;
+    if (!read(size) || static_cast<std::uint64_t>(end - pos) < size) {
+      return false;
+    }
+    value.assign(pos, size);
+    pos += size;
+    return true;
+  }
+};
+
+openstudio::path EpwFile::binaryCachePath(const openstudio::path& p) {
+  openstudio::path result = p;
+  result += toPath(".bin");
+  return result;
+}
+
+bool EpwFile::saveBinaryCache(const openstudio::path& cachePath) {
+  if (!openstudio::filesystem::is_regular_file(m_path)) {
+    LOG(Error, "A binary cache can only be written for an EpwFile loaded from a file");
+    return false;
+  }
+  if (m_data.empty()) {
+    data();
+  }
+  if (m_data.empty() || (m_headerLines.size() != 8)) {
+    LOG(Error, "EpwFile '" << toString(m_path) << "' has no data to write to a binary cache");
+    return false;
+  }
+
+  // write to a temporary file first so that a reader never sees a partial cache
+  openstudio::path tempPath = cachePath;
+  tempPath += toPath(".tmp");
+  {
+    openstudio::filesystem::ofstream os(tempPath, std::ios_base::binary);
+    if (!os.is_open()) {
+      LOG(Error, "Failed to open file '" << toString(tempPath) << "'");
+      return false;
+    }
+
+    os.write(binaryCacheMagic, sizeof(binaryCacheMagic));
+    writeBinary(os, binaryCacheVersion);
+    writeBinary(os, binaryCacheByteOrderMark);
+    writeBinary(os, m_checksum);
+    writeBinary(os, static_cast<std::uint64_t>(openstudio::filesystem::file_size(m_path)));
+    for (const std::string& line : m_headerLines) {
+      writeBinary(os, line);
+    }
+    writeBinary(os, static_cast<std::uint8_t>(m_isActual));
+    writeBinary(os, static_cast<std::uint8_t>(m_minutesMatch));
+    writeBinary(os, static_cast<std::int32_t>(m_startDateActualYear.value_or(0)));
+    writeBinary(os, static_cast<std::int32_t>(m_endDateActualYear.value_or(0)));
+
+    auto numRecords = static_cast<std::uint64_t>(m_data.size());
+    writeBinary(os, numRecords);
+    std::vector<std::int32_t> dateColumn(m_data.size());
+    using DateGetter = int (EpwDataPoint::*)() const;
+    for (DateGetter getter : {&EpwDataPoint::year, &EpwDataPoint::month, &EpwDataPoint::day, &EpwDataPoint::hour, &EpwDataPoint::minute}) {
+      for (std::size_t i = 0; i < m_data.size(); ++i) {
+        dateColumn[i] = (m_data[i].*getter)();
+      }
+      os.write(reinterpret_cast<const char*>(dateColumn.data()), dateColumn.size() * sizeof(std::int32_t));
+    }
+    std::vector<std::uint8_t> missingColumn(m_data.size());
+    for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+      const std::vector<double>& values = m_columns.values[field];
+      os.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+      std::copy(m_columns.missing[field].begin(), m_columns.missing[field].end(), missingColumn.begin());
+      os.write(reinterpret_cast<const char*>(missingColumn.data()), missingColumn.size());
+    }
+
+    std::string records;
+    for (const EpwDataPoint& pt : m_data) {
+      records += boost::algorithm::join(pt.toEpwStrings(), ",");
+      records += '\n';
+    }
+    writeBinary(os, records);
+
+    if (!os.good()) {
+      LOG(Error, "Failed to write binary cache '" << toString(tempPath) << "'");
+      os.close();
+      openstudio::filesystem::remove(tempPath);
+      return false;
+    }
+  }
+
+  try {
+    openstudio::filesystem::rename(tempPath, cachePath);
+  } catch (const std::exception& e) {
+    LOG(Error, "Failed to move binary cache to '" << toString(cachePath) << "': " << e.what());
+    openstudio::filesystem::remove(tempPath);
+    return false;
+  }
+  return true;
+}
+
+bool EpwFile::loadBinaryCache(const openstudio::path& cachePath, bool storeData) {
+  if (openstudio::filesystem::file_size(cachePath) == 0) {
+    return false;
+  }
+  boost::iostreams::mapped_file_source file(cachePath);
+  BinaryCacheReader reader{file.data(), file.data() + file.size()};
+
+  char magic[sizeof(binaryCacheMagic)];
+  std::uint32_t version = 0;
+  std::uint32_t byteOrderMark = 0;
+  if (!reader.read(magic, sizeof(magic)) || (std::memcmp(magic, binaryCacheMagic, sizeof(magic)) != 0) || !reader.read(version)
+      || (version != binaryCacheVersion) || !reader.read(byteOrderMark) || (byteOrderMark != binaryCacheByteOrderMark)) {
+    LOG(Warn, "'" << toString(cachePath) << "' is not a binary cache this version can read, EPW file '" << toString(m_path) << "' will be parsed");
+    return false;
+  }
+
+  std::string checksum;
+  std::uint64_t fileSize = 0;
+  if (!reader.read(checksum) || !reader.read(fileSize) || (checksum != m_checksum)
+      || (fileSize != openstudio::filesystem::file_size(m_path))) {
+    LOG(Info, "Binary cache '" << toString(cachePath) << "' is out of date, EPW file '" << toString(m_path) << "' will be parsed");
+    return false;
+  }
+
+  bool result = true;
+  for (unsigned i = 0; i < 8; ++i) {
+    std::string line;
+    if (!reader.read(line)) {
+      result = false;
+      break;
+    }
+    result = result && parseHeaderLine(i, line);
+    m_headerLines.push_back(line);
+  }
+
+  std::uint8_t isActual = 0;
+  std::uint8_t minutesMatch = 0;
+  std::int32_t startYear = 0;
+  std::int32_t endYear = 0;
+  std::uint64_t numRecords = 0;
+  result = result && reader.read(isActual) && reader.read(minutesMatch) && reader.read(startYear) && reader.read(endYear)
+           && reader.read(numRecords);
+  if (!result) {
+    LOG(Warn, "Binary cache '" << toString(cachePath) << "' cannot be read, EPW file '" << toString(m_path) << "' will be parsed");
+    return false;
+  }
+
+  m_isActual = (isActual != 0);
+  m_minutesMatch = (minutesMatch != 0);
+  if (startYear != 0) {
+    m_startDate = Date(m_startDate.monthOfYear(), m_startDate.dayOfMonth(), startYear);
+    m_startDateActualYear = startYear;
+  }
+  if (endYear != 0) {
+    m_endDate = Date(m_endDate.monthOfYear(), m_endDate.dayOfMonth(), endYear);
+    m_endDateActualYear = endYear;
+  }
+
+  if (!storeData) {
+    return true;
+  }
+
+  auto n = static_cast<std::size_t>(numRecords);
+  std::vector<std::vector<std::int32_t>> dateColumns(5, std::vector<std::int32_t>(n));
+  for (std::vector<std::int32_t>& column : dateColumns) {
+    result = result && reader.read(column.data(), n * sizeof(std::int32_t));
+  }
+  DataColumns columns;
+  std::size_t numFields = EpwDataField::getValues().size();
+  columns.values.resize(numFields);
+  columns.missing.resize(numFields);
+  columns.numMissing.assign(numFields, 0);
+  std::vector<std::uint8_t> missingColumn(n);
+  for (int field = EpwDataField::DryBulbTemperature; result && field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+    columns.values[field].resize(n);
+    result = reader.read(columns.values[field].data(), n * sizeof(double)) && reader.read(missingColumn.data(), n);
+    columns.missing[field].assign(missingColumn.begin(), missingColumn.end());
+    columns.numMissing[field] = std::count(columns.missing[field].begin(), columns.missing[field].end(), true);
+  }
+  std::string records;
+  result = result && reader.read(records);
+  if (!result) {
+    LOG(Warn, "Binary cache '" << toString(cachePath) << "' cannot be read, EPW file '" << toString(m_path) << "' will be parsed");
+    return false;
+  }
+
+  columns.dateTimes.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    columns.dateTimes.push_back(DateTime(Date(MonthOfYear(dateColumns[1][i]), static_cast<unsigned>(dateColumns[2][i]), dateColumns[0][i]),
+                                         Time(0, dateColumns[3][i], dateColumns[4][i])));
+  }
+  m_columns = std::move(columns);
+  m_cachedRecords = std::move(records);
+  return true;
+}
+
+bool EpwFile::parseCachedRecords() {
+  std::vector<EpwDataPoint> data;
+  data.reserve(m_columns.dateTimes.size());
+  std::size_t begin = 0;
+  while (begin < m_cachedRecords.size()) {
+    std::size_t end = m_cachedRecords.find('\n', begin);
+    if (end == std::string::npos) {
+      end = m_cachedRecords.size();
+    }
+    boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwString(m_cachedRecords.substr(begin, end - begin));
+    if (!pt) {
+      LOG(Error, "Failed to parse record " << data.size() + 1 << " of the binary cache of EPW file '" << m_path << "'");
+      return false;
+    }
+    data.push_back(pt.get());
+    begin = end + 1;
+  }
+  m_data = std::move(data);
+  m_cachedRecords.clear();
+  return true;
+}
+
 bool EpwFile::parse(std::istream& ifs, bool storeData) {
   // read line by line
   std::string line;
 
   bool result = true;
 
+  // start over, the data may already have been read from a binary cache
+  m_headerLines.clear();
+  if (storeData) {
+    m_data.clear();
+    m_columns = DataColumns();
+    m_cachedRecords.clear();
+  }
+
   // read first 8 lines
   for (unsigned i = 0; i < 8; ++i) {
 
@@ -4521,30 +4868,8 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
       return false;
     }
 
-    switch (i) {
-      case 0:  // LOCATION,
-        result = result && parseLocation(line);
-        break;
-      case 1:  // DESIGN CONDITIONS
-        result = result && parseDesignConditions(line);
-        break;
-      case 2:  // TYPICAL/EXTREME PERIODS
-        break;
-      case 3:  // GROUND TEMPERATURES
-        result = result && parseGroundTemperatures(line);
-        break;
-      case 4:  // HOLIDAYS/DAYLIGHT SAVINGS
-        result = result && parseHolidaysDaylightSavings(line);
-        break;
-      case 5:  // COMMENTS 1
-        break;
-      case 6:  // COMMENTS 2
-        break;
-      case 7:  // DATA PERIODS
-        result = result && parseDataPeriod(line);
-        break;
-      default:;
-    }
+    result = result && parseHeaderLine(i, line);
+    m_headerLines.push_back(line);
   }
 
   if (!result) {
@@ -4654,6 +4979,7 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
       EpwDataPoint::fromEpwStrings(epw_string.year, epw_string.month, day, epw_string.hour, epw_string.currentMinute, epw_string.strings);
     if (pt) {
       m_data.push_back(pt.get());
+      appendToColumns(m_data.back());
     } else {
       LOG(Error, "Failed to parse line " << epw_string.lineNumber << " of EPW file '" << m_path << "'");
       return false;
@@ -4707,6 +5033,29 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
   return result;
 }
 
+bool EpwFile::parseHeaderLine(unsigned i, const std::string& line) {
+  switch (i) {
+    case 0:  // LOCATION,
+      return parseLocation(line);
+    case 1:  // DESIGN CONDITIONS
+      return parseDesignConditions(line);
+    case 2:  // TYPICAL/EXTREME PERIODS
+      break;
+    case 3:  // GROUND TEMPERATURES
+      return parseGroundTemperatures(line);
+    case 4:  // HOLIDAYS/DAYLIGHT SAVINGS
+      return parseHolidaysDaylightSavings(line);
+    case 5:  // COMMENTS 1
+      break;
+    case 6:  // COMMENTS 2
+      break;
+    case 7:  // DATA PERIODS
+      return parseDataPeriod(line);
+    default:;
+  }
+  return true;
+}
+
 bool EpwFile::parseLocation(const std::string& line) {
   // LOCATION,Chicago Ohare Intl Ap,IL,USA,TMY3,725300,41.98,-87.92,-6.0,201.0
   // LOCATION, city, stateProvinceRegion, country, dataSource, wmoNumber, latitude, longitude, timeZone, elevation
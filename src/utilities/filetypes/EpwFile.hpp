@@ -245,9 +245,9 @@ class UTILITIES_API EpwDataPoint
   static std::string getUnits(EpwComputedField field);
   // Data retrieval
   /** Returns the double value of the named field if possible */
-  boost::optional<double> getFieldByName(const std::string& name);
+  boost::optional<double> getFieldByName(const std::string& name) const;
   /** Returns the dobule value of the field specified by enumeration value */
-  boost::optional<double> getField(EpwDataField id);
+  boost::optional<double> getField(EpwDataField id) const;
   /** Returns the air state specified by the EPW data. If dry bulb, pressure, and relative humidity are available,
       then those values will be used to compute the air state. Otherwise, unless dry bulb, pressure, and dew point are
       available, then an empty optional will be returned. Note that the air state may not be consistend with the EPW
@@ -992,6 +992,7 @@ class UTILITIES_API EpwFile
   EpwFile(const openstudio::path& p, bool storeData = false);
 
   /// static load method
+  /// reads the binary cache at binaryCachePath(p) instead of the EPW text if the cache was written for the current file
   static boost::optional<EpwFile> load(const openstudio::path& p, bool storeData = false);
 
   /// static load method
@@ -1069,6 +1070,12 @@ class UTILITIES_API EpwFile
   /// export to CONTAM WTH file
   bool translateToWth(openstudio::path path, std::string description = std::string());
 
+  /// get the path of the binary cache that load looks for, next to the EPW file at p
+  static openstudio::path binaryCachePath(const openstudio::path& p);
+
+  /// write a binary cache of the file, with the header and the weather data by column, for load to use while the EPW file is unchanged
+  bool saveBinaryCache(const openstudio::path& cachePath);
+
   // Data status (?) functions
   /// Returns true if the file appears to be AMY (as opposed to TMY)
   bool isActual() const;
@@ -1082,11 +1089,30 @@ class UTILITIES_API EpwFile
  private:
   EpwFile();
   bool parse(std::istream& is, bool storeData = false);
+  bool parseHeaderLine(unsigned i, const std::string& line);
+  bool loadBinaryCache(const openstudio::path& cachePath, bool storeData);
+  bool parseCachedRecords();
   bool parseLocation(const std::string& line);
   bool parseDesignConditions(const std::string& line);
   bool parseDataPeriod(const std::string& line);
   bool parseHolidaysDaylightSavings(const std::string& line);
   bool parseGroundTemperatures(const std::string& line);
+  void appendToColumns(const EpwDataPoint& pt);
+  const DateTimeVector& timeSeriesDateTimes();
+
+  // Numeric weather fields stored by column, so that time series do not have to go through the string based data points
+  struct DataColumns
+  {
+    // date and time of each record
+    std::vector<DateTime> dateTimes;
+    // date and time of each record as reported in time series, without the year for TMY data, filled on first use
+    std::vector<DateTime> timeSeriesDateTimes;
+    // one column per numeric EpwDataField, indexed by field value, missing values are stored as 0
+    std::vector<std::vector<double>> values;
+    // set where a record does not have a value for the field
+    std::vector<std::vector<bool>> missing;
+    std::vector<std::size_t> numMissing;
+  };
 
   // configure logging
   REGISTER_LOGGER("openstudio.EpwFile");
@@ -1109,6 +1135,10 @@ class UTILITIES_API EpwFile
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
   std::vector<EpwDataPoint> m_data;
+  DataColumns m_columns;
+  // data records read from a binary cache, one per line, parsed into m_data on first use
+  std::string m_cachedRecords;
+  std::vector<std::string> m_headerLines;
   std::vector<EpwDesignCondition> m_designs;
   std::vector<EpwGroundTemperatureDepth> m_depths;
 
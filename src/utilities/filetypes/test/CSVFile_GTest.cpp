@@ -14,6 +14,9 @@
 
 #include <resources.hxx>
 
+#include <ctime>
+#include <fstream>
+
 using namespace openstudio;
 
 TEST(Filetypes, CSVFile_New) {
@@ -272,3 +275,52 @@ TEST(Filetypes, CSVFile_AddAndGetColumn) {
   EXPECT_EQ("2.2", getCol4[1]);
   EXPECT_EQ("0.33", getCol4[2]);
 }
+
+TEST(Filetypes, CSVFile_LoadUnchangedFile) {
+  path p = toPath("./CSVFile_LoadUnchangedFile.csv");
+  {
+    std::ofstream ofs(toSystemFilename(p));
+    ofs << "2009-01-01T01:00:00,1,1.5,A\n2009-01-01T02:00:00,2,2.5,\"B, C\"\n";
+  }
+
+  boost::optional<CSVFile> csvFile = CSVFile::load(p);
+  ASSERT_TRUE(csvFile);
+  EXPECT_EQ(2u, csvFile->numRows());
+  EXPECT_EQ(4u, csvFile->numColumns());
+  EXPECT_EQ(2u, csvFile->getColumnAsDateTimes(0).size());
+  EXPECT_EQ(std::vector<double>({1.0, 2.0}), csvFile->getColumnAsDoubleVector(1));
+  EXPECT_EQ(std::vector<double>({1.5, 2.5}), csvFile->getColumnAsDoubleVector(2));
+  EXPECT_TRUE(csvFile->getColumnAsDoubleVector(3).empty());
+  EXPECT_EQ(std::vector<std::string>({"A", "B, C"}), csvFile->getColumnAsStringVector(3));
+
+  // loading the unchanged file again gives the same content
+  boost::optional<CSVFile> csvFile2 = CSVFile::load(p);
+  ASSERT_TRUE(csvFile2);
+  EXPECT_EQ(csvFile->string(), csvFile2->string());
+
+  // modifying one file does not modify the other
+  csvFile2->addRow({Variant("2009-01-01T03:00:00"), Variant(3), Variant(3.5), Variant("D")});
+  EXPECT_EQ(3u, csvFile2->numRows());
+  EXPECT_EQ(std::vector<double>({1.0, 2.0, 3.0}), csvFile2->getColumnAsDoubleVector(1));
+  EXPECT_EQ(2u, csvFile->numRows());
+  EXPECT_EQ(2u, CSVFile::load(p)->numRows());
+
+  // the file is parsed again once it changes
+  {
+    std::ofstream ofs(toSystemFilename(p));
+    ofs << "2009-01-01T01:00:00,10\n";
+  }
+  openstudio::filesystem::last_write_time(p, std::time(nullptr) + 10);
+  csvFile = CSVFile::load(p);
+  ASSERT_TRUE(csvFile);
+  EXPECT_EQ(1u, csvFile->numRows());
+  EXPECT_EQ(2u, csvFile->numColumns());
+  EXPECT_EQ(std::vector<double>({10.0}), csvFile->getColumnAsDoubleVector(1));
+
+  // and after it is saved
+  ASSERT_TRUE(csvFile2->saveAs(p));
+  csvFile = CSVFile::load(p);
+  ASSERT_TRUE(csvFile);
+  EXPECT_EQ(3u, csvFile->numRows());
+  EXPECT_EQ(std::vector<double>({1.5, 2.5, 3.5}), csvFile->getColumnAsDoubleVector(2));
+}
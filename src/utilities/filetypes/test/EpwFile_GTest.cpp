@@ -12,6 +12,8 @@
 #include <resources.hxx>
 
 #include <array>
+#include <fstream>
+#include <sstream>
 
 using namespace openstudio;
 
@@ -723,6 +725,113 @@ TEST(Filetypes, EpwFile_NonActualTimeSeries) {
   EXPECT_FALSE(_timeSeriesBaseYear);
 }
 
+TEST(Filetypes, EpwFile_TimeSeriesMatchesDataPoints) {
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p, true);
+  std::vector<EpwDataPoint> data = epwFile.data();
+  ASSERT_EQ(8760, data.size());
+
+  // Time series are built from the columns parsed with the data, they must agree with the data points, missing values included
+  for (const std::string& fieldName : {"Dry Bulb Temperature", "Atmospheric Station Pressure", "Total Sky Cover", "Liquid Precipitation Depth"}) {
+    std::vector<double> expected;
+    for (const EpwDataPoint& pt : data) {
+      if (boost::optional<double> value = pt.getFieldByName(fieldName)) {
+        expected.push_back(value.get());
+      }
+    }
+    boost::optional<TimeSeries> series = epwFile.getTimeSeries(fieldName);
+    if (expected.empty()) {
+      EXPECT_FALSE(series) << fieldName;
+      continue;
+    }
+    ASSERT_TRUE(series) << fieldName;
+    openstudio::Vector values = series->values();
+    ASSERT_EQ(expected.size(), values.size()) << fieldName;
+    for (unsigned i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i], values[i]) << fieldName << " " << i;
+    }
+  }
+
+  // Liquid Precipitation Depth is missing for part of the year
+  boost::optional<TimeSeries> depth = epwFile.getTimeSeries("Liquid Precipitation Depth");
+  ASSERT_TRUE(depth);
+  EXPECT_LT(depth->values().size(), 8760u);
+
+  boost::optional<TimeSeries> enthalpy = epwFile.getComputedTimeSeries("Enthalpy");
+  ASSERT_TRUE(enthalpy);
+  openstudio::Vector values = enthalpy->values();
+  ASSERT_EQ(8760, values.size());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_DOUBLE_EQ(data[i].enthalpy().get(), values[i]);
+  }
+}
+
+TEST(Filetypes, EpwFile_BinaryCache) {
+  for (const std::string& name : {"USA_CO_Golden-NREL.724666_TMY3.epw", "leapday-test.epw"}) {
+    openstudio::path fromPath = resourcesPath() / toPath("utilities/Filetypes") / toPath(name);
+    openstudio::path p = toPath("EpwFile_BinaryCache_" + name);
+    openstudio::path cachePath = EpwFile::binaryCachePath(p);
+    for (const auto& toRemove : {p, cachePath}) {
+      if (openstudio::filesystem::exists(toRemove)) {
+        openstudio::filesystem::remove(toRemove);
+      }
+    }
+    openstudio::filesystem::copy(fromPath, p);
+
+    boost::optional<EpwFile> epwFile = EpwFile::load(p, true);
+    ASSERT_TRUE(epwFile);
+    EXPECT_TRUE(epwFile->saveBinaryCache(cachePath));
+    ASSERT_TRUE(openstudio::filesystem::exists(cachePath));
+
+    boost::optional<EpwFile> cached = EpwFile::load(p, true);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(epwFile->checksum(), cached->checksum());
+    EXPECT_EQ(epwFile->city(), cached->city());
+    EXPECT_EQ(epwFile->latitude(), cached->latitude());
+    EXPECT_EQ(epwFile->recordsPerHour(), cached->recordsPerHour());
+    EXPECT_EQ(epwFile->startDate(), cached->startDate());
+    EXPECT_EQ(epwFile->endDate(), cached->endDate());
+    EXPECT_EQ(epwFile->startDateActualYear().value_or(0), cached->startDateActualYear().value_or(0));
+    EXPECT_EQ(epwFile->isActual(), cached->isActual());
+    EXPECT_EQ(epwFile->designConditions().size(), cached->designConditions().size());
+    EXPECT_EQ(epwFile->groundTemperatureDepths().size(), cached->groundTemperatureDepths().size());
+
+    boost::optional<TimeSeries> series = epwFile->getTimeSeries("Dry Bulb Temperature");
+    boost::optional<TimeSeries> cachedSeries = cached->getTimeSeries("Dry Bulb Temperature");
+    ASSERT_TRUE(series);
+    ASSERT_TRUE(cachedSeries);
+    EXPECT_EQ(series->firstReportDateTime(), cachedSeries->firstReportDateTime());
+    ASSERT_EQ(series->values().size(), cachedSeries->values().size());
+    for (unsigned i = 0; i < series->values().size(); ++i) {
+      EXPECT_EQ(series->values()[i], cachedSeries->values()[i]);
+    }
+
+    // The data points are parsed from the cache on demand
+    std::vector<EpwDataPoint> data = epwFile->data();
+    std::vector<EpwDataPoint> cachedData = cached->data();
+    ASSERT_EQ(data.size(), cachedData.size());
+    for (unsigned i = 0; i < data.size(); ++i) {
+      EXPECT_EQ(data[i].toEpwStrings(), cachedData[i].toEpwStrings());
+    }
+
+    // Once the EPW file changes the cache is ignored
+    {
+      std::ifstream is(openstudio::toSystemFilename(p));
+      std::stringstream ss;
+      ss << is.rdbuf();
+      std::string text = ss.str();
+      text.insert(text.find("COMMENTS 1,") + 11, "Modified ");
+      is.close();
+      std::ofstream os(openstudio::toSystemFilename(p));
+      os << text;
+    }
+    boost::optional<EpwFile> modified = EpwFile::load(p, true);
+    ASSERT_TRUE(modified);
+    EXPECT_NE(epwFile->checksum(), modified->checksum());
+    EXPECT_EQ(data.size(), modified->data().size());
+  }
+}
+
 TEST(Filetypes, EpwFile_International_Data) {
   path p = resourcesPath() / toPath("utilities/Filetypes/CHN_Guangdong.Shaoguan.590820_CSWD.epw");
   EpwFile epwFile(p, true);
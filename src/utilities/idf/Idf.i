@@ -84,6 +84,10 @@
 // ignore detail namespace
 %ignore openstudio::detail;
 
+// takes a callback on implementation objects
+%ignore openstudio::Workspace::forEachObjectOfType;
+%ignore openstudio::Workspace::BatchEdit;
+
 // ignore functions taking streams that were not previously already ignored on a global scale
 %ignore openstudio::IdfFile::load(std::istream&);
 %ignore openstudio::IdfFile::load(std::istream&, IddFileType);
@@ -6,23 +6,90 @@
 #include "IdfFile.hpp"
 #include <utilities/idf/IdfObject_Impl.hpp>  // needed for serialization
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddRegex.hpp"
 #include <utilities/idd/IddFactory.hxx>
 #include <utilities/idd/IddEnums.hxx>
-#include "../idd/CommentRegex.hpp"
 #include "../idd/Comments.hpp"
 
 #include "../plot/ProgressBar.hpp"
 #include "../core/PathHelpers.hpp"
 #include "../core/Assert.hpp"
 
-#include <boost/iostreams/filter/newline.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
 
 namespace openstudio {
 
+namespace {
+
+  // same as boost::regex_match(objectType, iddRegex::versionObjectName())
+  bool isVersionObjectName(const std::string& objectType) {
+    for (std::size_t pos = objectType.find("ersion", 1); pos != std::string::npos; pos = objectType.find("ersion", pos + 1)) {
+      if ((objectType[pos - 1] == 'v') || (objectType[pos - 1] == 'V')) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // An object's text, and the result of parsing it
+  struct ObjectText
+  {
+    std::size_t start = 0;  // start of the object text, including any preceding comment lines
+    std::size_t end = 0;
+    std::string_view firstLine;  // the first line that is not a comment
+    std::string objectType;      // as found in the text, "Catchall" if not on the first line
+    bool typeOnFirstLine = false;
+    bool typeInIdd = false;
+    bool isVersion = false;
+    bool constructed = false;  // whether construction was attempted, if so impl is null on failure
+    std::shared_ptr<detail::IdfObject_Impl> impl;
+  };
+
+  // Tokenizes the object starting at object.start, and constructs it unless the file ended before the
+  // object did. Only reads from iddFileAndFactoryWrapper, so objects may be parsed concurrently.
+  void parseObject(std::string_view text, const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper, bool versionOnly,
+                   detail::IdfObjectTokens& tokens, ObjectText& object) {
+    detail::IdfTokenizer tokenizer(text);
+    tokenizer.setPosition(object.start);
+    tokenizer.readObject(tokens, true);
+    object.end = tokenizer.position();
+
+    // get the object type for indexing in map
+    object.typeOnFirstLine = tokens.objectTypeOnFirstLine;
+    if (object.typeOnFirstLine) {
+      object.objectType = std::string(*tokens.objectType);
+    } else {
+      // can't figure out the object's type
+      object.objectType = "Catchall";
+    }
+    object.isVersion = isVersionObjectName(object.objectType);
+
+    // get the corresponding idd object entry
+    OptionalIddObject iddObject = iddFileAndFactoryWrapper.getObject(object.objectType);
+    object.typeInIdd = iddObject.has_value();
+    if (!iddObject) {
+      iddObject = IddObject();
+    } else {
+      OS_ASSERT(iddObject->type() != IddObjectType::Catchall);
+    }
+
+    // construct the object, unless the file ended before the object did
+    object.constructed = tokens.complete && (!versionOnly || object.isVersion);
+    if (object.constructed) {
+      object.impl = detail::IdfObject_Impl::load(tokens, *iddObject);
+    }
+  }
+
+}  // namespace
+
 // CONSTRUCTORS
 
 IdfFile::IdfFile(IddFileType iddFileType) : m_iddFileAndFactoryWrapper(iddFileType) {
@@ -288,13 +355,13 @@ ValidityReport IdfFile::validityReport(StrictnessLevel level) const {
 
 // SERIALIZATON
 
-boost::optional<IdfFile> IdfFile::load(std::istream& is, const IddFileType& iddFileType, ProgressBar* progressBar) {
+boost::optional<IdfFile> IdfFile::load(std::istream& is, const IddFileType& iddFileType, ProgressBar* progressBar, unsigned nThreads) {
   IdfFile result(iddFileType);
   // remove initial version object
   if (OptionalIdfObject vo = result.versionObject()) {
     result.removeObject(*vo);
   }
-  if (result.m_load(is, progressBar)) {
+  if (result.m_load(is, progressBar, false, nThreads)) {
     // check for it again here
     result.addVersionObject();
     return result;
@@ -302,13 +369,13 @@ boost::optional<IdfFile> IdfFile::load(std::istream& is, const IddFileType& iddF
   return boost::none;
 }
 
-OptionalIdfFile IdfFile::load(std::istream& is, const IddFile& iddFile, ProgressBar* progressBar) {
+OptionalIdfFile IdfFile::load(std::istream& is, const IddFile& iddFile, ProgressBar* progressBar, unsigned nThreads) {
   IdfFile result(iddFile);
   // remove initial version object
   if (OptionalIdfObject vo = result.versionObject()) {
     result.removeObject(*vo);
   }
-  if (result.m_load(is, progressBar)) {
+  if (result.m_load(is, progressBar, false, nThreads)) {
     // check for it again here
     result.addVersionObject();
     return result;
@@ -316,7 +383,7 @@ OptionalIdfFile IdfFile::load(std::istream& is, const IddFile& iddFile, Progress
   return boost::none;
 }
 
-OptionalIdfFile IdfFile::load(const path& p, ProgressBar* progressBar) {
+OptionalIdfFile IdfFile::load(const path& p, ProgressBar* progressBar, unsigned nThreads) {
   // determine IddFileType
   IddFileType iddType(IddFileType::EnergyPlus);  // default
 
@@ -330,10 +397,10 @@ OptionalIdfFile IdfFile::load(const path& p, ProgressBar* progressBar) {
     iddType = IddFileType(IddFileType::OpenStudio);
   }
 
-  return load(p, iddType, progressBar);
+  return load(p, iddType, progressBar, nThreads);
 }
 
-OptionalIdfFile IdfFile::load(const path& p, const IddFileType& iddFileType, ProgressBar* progressBar) {
+OptionalIdfFile IdfFile::load(const path& p, const IddFileType& iddFileType, ProgressBar* progressBar, unsigned nThreads) {
   // complete path
   path wp(p);
 
@@ -357,34 +424,16 @@ OptionalIdfFile IdfFile::load(const path& p, const IddFileType& iddFileType, Pro
   // In fact, don't pass the ext param, skip the entire call to setFileExtension which is pointless since it won't force replace it
   wp = completePathToFile(wp, path(), "", false);
 
-  // try to open file and parse
-  openstudio::filesystem::ifstream inFile(wp);
-  if (inFile) {
-    try {
-      return load(inFile, iddFileType, progressBar);
-    } catch (...) {
-      return boost::none;
-    }
-  }
-
-  return boost::none;
+  // try to map file and parse
+  return m_load(IdfFile(iddFileType), wp, progressBar, nThreads);
 }
 
-OptionalIdfFile IdfFile::load(const path& p, const IddFile& iddFile, ProgressBar* progressBar) {
+OptionalIdfFile IdfFile::load(const path& p, const IddFile& iddFile, ProgressBar* progressBar, unsigned nThreads) {
   // complete path
   path wp = completePathToFile(p, path(), "idf", false);
 
-  // try to open file and parse
-  openstudio::filesystem::ifstream inFile(wp);
-  if (inFile) {
-    try {
-      return load(inFile, iddFile, progressBar);
-    } catch (...) {
-      return boost::none;
-    }
-  }
-
-  return boost::none;
+  // try to map file and parse
+  return m_load(IdfFile(iddFile), wp, progressBar, nThreads);
 }
 
 boost::optional<VersionString> IdfFile::loadVersionOnly(std::istream& is) {
@@ -496,55 +545,111 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
 
 // SERIALIZATION
 
-bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
+bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly, unsigned nThreads) {
+  // read the whole stream at once, the tokenizer handles any line endings
+  std::string text;
+  {
+    std::stringstream ss;
+    ss << is.rdbuf();
+    text = std::move(ss).str();
+  }
+  return m_load(std::string_view(text), progressBar, versionOnly, nThreads);
+}
+
+bool IdfFile::m_load(std::string_view text, ProgressBar* progressBar, bool versionOnly, unsigned nThreads) {
+
+  if (nThreads == 0) {
+    nThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  // loadVersionOnly stops at the version object, which is usually at the top of the file
+  const bool parallel = (nThreads > 1) && !versionOnly;
+
+  int objectNum = 0;             // number of objects, first is #1
+  std::string comment;           // keep running comment
+  std::size_t commentStart = 0;  // position of the first line of the running comment
+  bool firstBlock = true;        // to capture first comment block as the header
 
-  [[maybe_unused]] int lineNum = 0;  // Idf line number
-  int objectNum = 0;                 // number of objects, first is #1
-  std::string line;                  // temp string to help with reading
-  boost::smatch matches;             // matches to regular expressions
-  std::string comment;               // keep running comment
-  bool firstBlock = true;            // to capture first comment block as the header
+  // when parsing in parallel, object boundaries are found first and objects are parsed later
+  std::vector<ObjectText> objects;
+  std::vector<std::pair<std::size_t, std::string>> commentOnlyObjects;  // index into objects, comment
 
   if (progressBar) {
-    is.seekg(0, std::ios_base::end);
-    int streamsize = static_cast<int>(is.tellg());
     progressBar->setMinimum(0);
-    progressBar->setMaximum(streamsize);
-    is.seekg(0, std::ios_base::beg);
+    progressBar->setMaximum(static_cast<int>(text.size()));
   }
 
-  // Use a boost filter to make sure that no matter what line endings come in,
-  // they are converted to what is expected by the current os
-  boost::iostreams::filtering_istream filt;
+  auto addCommentOnlyObject = [this](const std::string& comment) {
+    // make a comment only object to hold the comment
+    OptionalIddObject commentOnlyIddObject = m_iddFileAndFactoryWrapper.getObject(IddObjectType::CommentOnly);
+    if (!commentOnlyIddObject) {
+      LOG(Error, "IddFile does not contain a CommentOnly object. Will not be able to save comment objects.");
+      return;
+    }
+
+    OptionalIdfObject commentOnlyObject;
+    commentOnlyObject = IdfObject::load(commentOnlyIddObject->name() + ";" + comment, *commentOnlyIddObject);
+    OS_ASSERT(commentOnlyObject);
 
-  //#ifdef _POSIX_VERSION
-  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::posix));
-  //#else
-  //  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::dos));
-  //#endif
-  filt.push(is);
+    // put it in the object list
+    addObject(*commentOnlyObject);
+  };
 
-  // read the file line by line using regexes
-  while (std::getline(filt, line)) {
+  // returns true if loading should stop
+  auto addParsedObject = [this, &objectNum, text, versionOnly](const ObjectText& object) {
+    if (!object.typeOnFirstLine && !versionOnly) {
+      LOG(Warn, "Unrecognizable object type '" << object.firstLine << "'. Defaulting to 'Catchall'.");
+    }
+    if (!object.typeInIdd && !versionOnly) {
+      LOG(Warn, "Cannot find object type '" + object.objectType + "' in Idd. Placing data in Catchall object.");
+    }
 
-    if (line == "\r") {
-      // This is not a real line at all, just the vestiges from the
-      // previous windows formatted line being parsed on unix, skip it,
-      // don't even count it
-      continue;
+    if (object.constructed) {
+      if (!object.impl) {
+        LOG(Error, "Unable to construct IdfObject from text: " << '\n'
+                                                               << text.substr(object.start, object.end - object.start) << '\n'
+                                                               << "Throwing this object out and parsing the remainder of the file.");
+        return false;
+      }
+
+      // a valid Idf object to parse
+      if (object.impl->iddObject().type() != IddObjectType::Catchall) {
+        ++objectNum;
+      }
+
+      // put it in the object list
+      addObject(object.impl->getObject<IdfObject>());
     }
 
-    ++lineNum;
+    if (versionOnly && object.isVersion) {
+      // Increment objectNum to avoid triggering the warning below and return false
+      ++objectNum;
+      return true;
+    }
+    return false;
+  };
 
-    if (progressBar) {
-      int current = static_cast<int>(is.tellg());
-      progressBar->setValue(current);
+  detail::IdfTokenizer tokenizer(text);
+  detail::IdfObjectTokens tokens;
+
+  // read the file line by line, and object by object
+  while (!tokenizer.atEnd()) {
+
+    if (progressBar && !parallel) {
+      progressBar->setValue(static_cast<int>(tokenizer.position()));
     }
 
-    if (boost::regex_match(line, idfRegex::commentOnlyLine())) {
+    detail::IdfTokenizer::LineType lineType = tokenizer.lineType();
+
+    if (lineType == detail::IdfTokenizer::LineType::CommentOnly) {
       // continue comment
-      comment += (line + idfRegex::newLinestring());
-    } else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())) {
+      if (comment.empty()) {
+        commentStart = tokenizer.position();
+      }
+      comment += tokenizer.readLine();
+      comment += idfRegex::newLinestring();
+    } else if (lineType == detail::IdfTokenizer::LineType::WhitespaceOnly) {
+      tokenizer.readLine();
+
       // end comment
       boost::trim(comment);
 
@@ -553,112 +658,85 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
           // set this comment as the header
           setHeader(comment);
           firstBlock = false;
-        } else {
-          if (!versionOnly) {
-
-            // make a comment only object to hold the comment
-            OptionalIddObject commentOnlyIddObject = m_iddFileAndFactoryWrapper.getObject(IddObjectType::CommentOnly);
-            if (!commentOnlyIddObject) {
-              LOG(Error, "IddFile does not contain a CommentOnly object. Will not be able to save comment objects.");
-              continue;
-            }
-
-            OptionalIdfObject commentOnlyObject;
-            commentOnlyObject = IdfObject::load(commentOnlyIddObject->name() + ";" + comment, *commentOnlyIddObject);
-            OS_ASSERT(commentOnlyObject);
-
-            // put it in the object list
-            addObject(*commentOnlyObject);
-          }
+        } else if (parallel) {
+          commentOnlyObjects.emplace_back(objects.size(), comment);
+        } else if (!versionOnly) {
+          addCommentOnlyObject(comment);
         }
       }
 
       //clear out comment
-      comment = "";
+      comment.clear();
 
     } else {
 
-      bool foundEndLine(false);
       firstBlock = false;
-      bool isVersion = false;
 
-      // peek at the object type and name for indexing in map
-      std::string objectType;
-
-      if (boost::regex_search(line, matches, idfRegex::line())) {
-        objectType = std::string(matches[1].first, matches[1].second);
-        boost::trim(objectType);
-      } else {
-        // can't figure out the object's type
-        if (!versionOnly) {
-          LOG(Warn, "Unrecognizable object type '" + line + "'. Defaulting to 'Catchall'.");
-        }
-        objectType = "Catchall";
-      }
-      if (boost::regex_match(objectType, iddRegex::versionObjectName())) {
-        isVersion = true;
-      }
-
-      // get the corresponding idd object entry
-
-      OptionalIddObject iddObject = m_iddFileAndFactoryWrapper.getObject(objectType);
-      if (!iddObject) {
-        if (!versionOnly) {
-          LOG(Warn, "Cannot find object type '" + objectType + "' in Idd. Placing data in Catchall object.");
-        }
-        iddObject = IddObject();
-        objectType = "Catchall";
-      } else {
-        OS_ASSERT(iddObject->type() != IddObjectType::Catchall);
+      // the object text starts with the running comment, and ends with the first line holding a ';'
+      ObjectText object;
+      object.firstLine = tokenizer.line();
+      object.start = comment.empty() ? tokenizer.position() : commentStart;
+      tokenizer.setPosition(object.start);
+      comment.clear();
+
+      if (parallel) {
+        tokenizer.skipObject();
+        object.end = tokenizer.position();
+        objects.push_back(std::move(object));
+        continue;
       }
 
-      // put the text for this object in a new string with a newline
-      std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
-      comment = "";
-
-      // check if this line also matches closing line object
-      if (boost::regex_match(line, idfRegex::objectEnd())) {
-        foundEndLine = true;
+      parseObject(text, m_iddFileAndFactoryWrapper, versionOnly, tokens, object);
+      tokenizer.setPosition(object.end);
+      if (addParsedObject(object)) {
+        break;
       }
+    }
+  }
 
-      // continue reading until we have seen the entire object
-      // last line will be thrown away, requires empty line between objects in Idf
-      while ((!foundEndLine) && (std::getline(filt, line))) {
-        ++lineNum;
-
-        // add line to text, include newline separator
-        text += (line + idfRegex::newLinestring());
+  if (parallel) {
+    // parse chunks of objects concurrently, and add them in file order as each chunk completes
+    const std::size_t chunkSize = std::max<std::size_t>(64, objects.size() / (16 * nThreads));
+    const std::size_t nChunks = (objects.size() + chunkSize - 1) / chunkSize;
+    std::vector<std::promise<void>> chunksParsed(nChunks);
+    std::atomic<std::size_t> nextChunk(0);
 
-        // check if we have found the last field
-        if (boost::regex_match(line, idfRegex::objectEnd())) {
-          foundEndLine = true;
+    auto parseChunks = [&]() {
+      detail::IdfObjectTokens chunkTokens;
+      for (std::size_t chunk = nextChunk++; chunk < nChunks; chunk = nextChunk++) {
+        try {
+          std::size_t end = std::min(objects.size(), (chunk + 1) * chunkSize);
+          for (std::size_t i = chunk * chunkSize; i < end; ++i) {
+            parseObject(text, m_iddFileAndFactoryWrapper, versionOnly, chunkTokens, objects[i]);
+          }
+          chunksParsed[chunk].set_value();
+        } catch (...) {
+          chunksParsed[chunk].set_exception(std::current_exception());
         }
       }
+    };
 
-      // construct the object
-      if (foundEndLine && (!versionOnly || isVersion)) {
-        OptionalIdfObject object = IdfObject::load(text, *iddObject);
-        if (!object) {
-          LOG(Error, "Unable to construct IdfObject from text: " << '\n'
-                                                                 << text << '\n'
-                                                                 << "Throwing this object out and parsing the remainder of the file.");
-          continue;
-        } else {
-          // a valid Idf object to parse
-          if (object->iddObject().type() != IddObjectType::Catchall) {
-            ++objectNum;
-          }
+    // the futures join the workers on destruction, even if an exception is thrown below
+    std::vector<std::future<void>> workers;
+    for (unsigned i = 0, n = static_cast<unsigned>(std::min<std::size_t>(nThreads, nChunks)); i < n; ++i) {
+      workers.push_back(std::async(std::launch::async, parseChunks));
+    }
 
-          // put it in the object list
-          addObject(*object);
-        }
+    auto commentIt = commentOnlyObjects.cbegin();
+    for (std::size_t i = 0, n = objects.size(); i <= n; ++i) {
+      for (; (commentIt != commentOnlyObjects.cend()) && (commentIt->first == i); ++commentIt) {
+        addCommentOnlyObject(commentIt->second);
       }
-
-      if (versionOnly && isVersion) {
-        // Increment objectNum to avoid triggering the warning below and return false
-        ++objectNum;
+      if (i == n) {
         break;
       }
+      if (i % chunkSize == 0) {
+        chunksParsed[i / chunkSize].get_future().get();
+      }
+      addParsedObject(objects[i]);
+      if (progressBar) {
+        progressBar->setValue(static_cast<int>(objects[i].end));
+      }
     }
   }
 
@@ -671,6 +749,35 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
   }
 }
 
+boost::optional<IdfFile> IdfFile::m_load(IdfFile result, const path& p, ProgressBar* progressBar, unsigned nThreads) {
+  try {
+    if (!openstudio::filesystem::is_regular_file(p)) {
+      return boost::none;
+    }
+
+    // an empty file can not be mapped
+    boost::iostreams::mapped_file_source file;
+    std::string_view text;
+    if (openstudio::filesystem::file_size(p) > 0) {
+      file.open(p);
+      text = std::string_view(file.data(), file.size());
+    }
+
+    // remove initial version object
+    if (OptionalIdfObject vo = result.versionObject()) {
+      result.removeObject(*vo);
+    }
+    if (result.m_load(text, progressBar, false, nThreads)) {
+      // check for it again here
+      result.addVersionObject();
+      return result;
+    }
+  } catch (...) {
+  }
+
+  return boost::none;
+}
+
 IddFileAndFactoryWrapper IdfFile::iddFileAndFactoryWrapper() const {
   return m_iddFileAndFactoryWrapper;
 }
@@ -14,6 +14,7 @@
 #include "../core/Path.hpp"
 
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <vector>
 
@@ -151,24 +152,30 @@ class UTILITIES_API IdfFile
   //@{
 
   /** Load an IdfFile from std::istream using the IDD defined by IddFactory and iddFileType, if
-   *  possible. */
-  static boost::optional<IdfFile> load(std::istream& is, const IddFileType& iddFileType, ProgressBar* progressBar = nullptr);
+   *  possible. Objects are parsed on nThreads threads (see load(const path&, ProgressBar*,
+   *  unsigned)). */
+  static boost::optional<IdfFile> load(std::istream& is, const IddFileType& iddFileType, ProgressBar* progressBar = nullptr,
+                                       unsigned nThreads = 1);
 
   /** Load an IdfFile from std::istream using iddFile, if possible. */
-  static boost::optional<IdfFile> load(std::istream& is, const IddFile& iddFile, ProgressBar* progressBar = nullptr);
+  static boost::optional<IdfFile> load(std::istream& is, const IddFile& iddFile, ProgressBar* progressBar = nullptr, unsigned nThreads = 1);
 
   /** Load an IdfFile from path using the IddFactory, and choosing iddFileType based on file
    *  extension, if possible. (IddFileType::OpenStudio if extension is modelFileExtension() or
-   *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) */
-  static boost::optional<IdfFile> load(const path& p, ProgressBar* progressBar = nullptr);
+   *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) The file is memory mapped.
+   *  If nThreads > 1, object boundaries are found first and the objects are then parsed on
+   *  nThreads threads; nThreads == 0 uses one thread per hardware core. The result, including
+   *  the order of objects, does not depend on nThreads, and progressBar is only updated from the
+   *  calling thread. */
+  static boost::optional<IdfFile> load(const path& p, ProgressBar* progressBar = nullptr, unsigned nThreads = 1);
 
   /** Load an IdfFile from path using the IddFactory and iddFileType, if possible. Will attempt to
    *  complete the path by tacking on .osm or .idf as appropriate. */
-  static boost::optional<IdfFile> load(const path& p, const IddFileType& iddFileType, ProgressBar* progressBar = nullptr);
+  static boost::optional<IdfFile> load(const path& p, const IddFileType& iddFileType, ProgressBar* progressBar = nullptr, unsigned nThreads = 1);
 
   /** Load an IdfFile from path using iddFile, if possible. If no file extension is provided, will
    *  try "idf". */
-  static boost::optional<IdfFile> load(const path& p, const IddFile& iddFile, ProgressBar* progressBar = nullptr);
+  static boost::optional<IdfFile> load(const path& p, const IddFile& iddFile, ProgressBar* progressBar = nullptr, unsigned nThreads = 1);
 
   /** Quick load method that uses the IddFile::catchallIddFile and stops parsing once a version
    *  identifier is found. Used to determine the appropriate IddFile to use for a full load. */
@@ -213,7 +220,13 @@ class UTILITIES_API IdfFile
   // SERIALIZATION
 
   /// private load function that uses m_iddFile and m_iddFileType initialized elsewhere
-  bool m_load(std::istream& is, ProgressBar* progressBar = nullptr, bool versionOnly = false);
+  bool m_load(std::istream& is, ProgressBar* progressBar = nullptr, bool versionOnly = false, unsigned nThreads = 1);
+
+  /// private load function that parses text, which is not copied
+  bool m_load(std::string_view text, ProgressBar* progressBar, bool versionOnly, unsigned nThreads);
+
+  /// private load function that memory maps the file at p and parses it into result
+  static boost::optional<IdfFile> m_load(IdfFile result, const path& p, ProgressBar* progressBar, unsigned nThreads);
 
   // configure logging
   REGISTER_LOGGER("utilities.idf.IdfFile");
@@ -7,14 +7,13 @@
 #include "IdfObject_Impl.hpp"
 
 #include "IdfExtensibleGroup.hpp"
-#include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddKey.hpp"
 #include <utilities/idd/IddFactory.hxx>
 #include <utilities/idd/IddEnums.hxx>
 #include "../idd/IddRegex.hpp"
-#include "../idd/CommentRegex.hpp"
 #include "../idd/Comments.hpp"
 
 #include "../math/FloatCompare.hpp"
@@ -36,7 +35,11 @@ namespace detail {
   // CONSTRUCTORS
 
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
-    : m_comment(other.comment()), m_iddObject(other.iddObject()), m_fields(other.fields()), m_fieldComments(other.fieldComments()) {
+    : m_comment(other.comment()),
+      m_iddObject(other.iddObject()),
+      m_fields(other.m_fields),
+      m_fieldComments(other.fieldComments()),
+      m_cachedNumbers(other.m_cachedNumbers) {
     if (keepHandle) {
       OS_ASSERT(!other.handle().isNull());
       m_handle = other.handle();
@@ -91,7 +94,7 @@ namespace detail {
     OS_ASSERT(minimal);
   }
 
-  IdfObject_Impl::IdfObject_Impl(const Handle& handle, const std::string& comment, const IddObject& iddObject, const StringVector& fields,
+  IdfObject_Impl::IdfObject_Impl(const Handle& handle, const std::string& comment, const IddObject& iddObject, const SharedFieldVector& fields,
                                  const StringVector& fieldComments)
     : m_handle(handle), m_comment(comment), m_iddObject(iddObject), m_fields(fields), m_fieldComments(fieldComments) {
     resizeToMinFields();
@@ -192,7 +195,7 @@ namespace detail {
   boost::optional<std::string> IdfObject_Impl::getString(unsigned index, bool returnDefault, bool returnUninitializedEmpty) const {
     OptionalString result;
     if (index < m_fields.size()) {
-      result = m_fields[index];
+      result = fieldText(index);
     }
     if (returnDefault && ((result && result->empty()) || (!result))) {
       OptionalIddField iddField = m_iddObject.getField(index);
@@ -214,6 +217,10 @@ namespace detail {
   }
 
   boost::optional<double> IdfObject_Impl::getDouble(unsigned index, bool returnDefault) const {
+    if (boost::optional<double> cached = cachedNumber(index)) {
+      return cached;
+    }
+
     OptionalDouble result;
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
@@ -234,6 +241,14 @@ namespace detail {
   }
 
   boost::optional<unsigned> IdfObject_Impl::getUnsigned(unsigned index, bool returnDefault) const {
+    if (boost::optional<double> cached = cachedNumber(index)) {
+      try {
+        return boost::numeric_cast<unsigned>(*cached);
+      } catch (const std::exception&) {
+        // out of range, logged below
+      }
+    }
+
     OptionalUnsigned result;
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
@@ -250,6 +265,14 @@ namespace detail {
   }
 
   boost::optional<int> IdfObject_Impl::getInt(unsigned index, bool returnDefault) const {
+    if (boost::optional<double> cached = cachedNumber(index)) {
+      try {
+        return boost::numeric_cast<int>(*cached);
+      } catch (const std::exception&) {
+        // out of range, logged below
+      }
+    }
+
     OptionalInt result;
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
@@ -315,7 +338,8 @@ namespace detail {
 
       m_fieldComments[index] = makeComment(cmnt);
 
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], m_fields[index]));
+      std::string text = fieldText(index);
+      m_diffs.push_back(IdfObjectDiff(index, text, text));
 
       return true;
     }
@@ -372,17 +396,20 @@ namespace detail {
       OS_ASSERT(i < 2u);
       if (n == 0 && i == 1) {
         OS_ASSERT(!m_handle.isNull());
-        m_fields.push_back(toString(m_handle));
-        m_diffs.push_back(IdfObjectDiff(0u, boost::none, m_fields.back()));
+        m_fields.edit().emplace_back();
+        m_diffs.push_back(IdfObjectDiff(0u, boost::none, toString(m_handle)));
       }
       n = numFields();
       if (i < n) {
         std::string oldName = m_fields[i];
-        m_fields[i] = newName;
+        m_fields.edit()[i] = newName;
+        clearCachedNumber(i);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
+        nameFieldChanged(decodeString(oldName));
       } else {
-        m_fields.push_back(newName);
+        m_fields.edit().push_back(newName);
         m_diffs.push_back(IdfObjectDiff(i, boost::none, newName));
+        nameFieldChanged(boost::none);
       }
       //return decoded string since we might have made changes to it if its an EMS object.
       newName = decodeString(newName);
@@ -442,7 +469,7 @@ namespace detail {
           nn = m_fields.size();
         }
       } else {
-        oldValue = m_fields[index];
+        oldValue = fieldText(index);
       }
 
       if (!result) {
@@ -450,17 +477,23 @@ namespace detail {
         m_diffs.resize(diffSize);
 
         // resize fields
-        m_fields.resize(n);
-        if (m_fieldComments.size() > n) {
-          m_fieldComments.resize(n);
-        }
+        truncateFields(n);
 
         return false;
       }
 
       OS_ASSERT(index < m_fields.size());
 
-      m_fields[index] = value;
+      // unchanged text leaves storage shared with any copies of this object
+      if ((index == 0) && m_iddObject.hasHandleField() && (value == toString(m_handle))) {
+        // the usual case of writing an object's own handle, which is not stored as text
+        if (!m_fields[index].empty()) {
+          m_fields.edit()[index].clear();
+        }
+      } else if (m_fields[index] != value) {
+        m_fields.edit()[index] = value;
+      }
+      clearCachedNumber(index);
       m_diffs.emplace_back(index, oldValue, value);
       return result;
     }
@@ -562,7 +595,7 @@ namespace detail {
 
     // ok if nonextensible, or extensible w/ group size 1
     if (m_iddObject.isNonextensibleField(index) || (m_iddObject.isExtensibleField(index) && (m_iddObject.properties().numExtensible == 1))) {
-      m_fields.push_back(value);
+      m_fields.edit().push_back(value);
       m_diffs.push_back(IdfObjectDiff(index, boost::none, value));
       return true;
     }
@@ -600,10 +633,7 @@ namespace detail {
         m_diffs.resize(diffSize);
 
         // resize the fields
-        m_fields.resize(n);
-        if (m_fieldComments.size() > n) {
-          m_fieldComments.resize(n);
-        }
+        truncateFields(n);
         return result;
       }
     }
@@ -620,7 +650,7 @@ namespace detail {
         wValues.resize(groupSize);
       }
 
-      m_fields.resize(n + groupSize);
+      m_fields.edit().resize(n + groupSize);
 
       for (unsigned i = 0; i < groupSize; ++i) {
 
@@ -630,10 +660,7 @@ namespace detail {
           m_diffs.resize(diffSize);
 
           // resize the fields
-          m_fields.resize(n);
-          if (m_fieldComments.size() > n) {
-            m_fieldComments.resize(n);
-          }
+          truncateFields(n);
           return result;
         }
       }
@@ -786,7 +813,8 @@ namespace detail {
         m_diffs.push_back(IdfObjectDiff(numBeforePop - 1 - i, result[i], boost::none));
       }
 
-      m_fields.resize(numAfterPop);
+      m_fields.edit().resize(numAfterPop);
+      clearCachedNumbers(numAfterPop);
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(numAfterPop);
       }
@@ -930,7 +958,7 @@ namespace detail {
     bool resized = false;
     if (n < iddN) {
       resized = true;
-      m_fields.resize(iddN);
+      m_fields.edit().resize(iddN);
     }
     if (!fill_default) {
       if (resized) {
@@ -947,8 +975,12 @@ namespace detail {
       if (m_fields[index].empty()) {
         OptionalIddField iddField = m_iddObject.getField(index);
         if (iddField && iddField->properties().stringDefault) {
-          m_fields[index] = *(iddField->properties().stringDefault);
+          m_fields.edit()[index] = *(iddField->properties().stringDefault);
+          clearCachedNumber(index);
           dataChange = true;
+          if (iddField->isNameField()) {
+            nameFieldChanged(std::string());
+          }
           // m_diffs.push_back(IdfObjectDiff(index, boost::none, m_fields[index] ));
         }
       }
@@ -1254,6 +1286,25 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(const IdfObjectTokens& tokens, const IddObject& iddObject) {
+    // parse in place rather than copying a temporary as above, this is the IdfFile loading hot path
+    std::shared_ptr<IdfObject_Impl> result(new IdfObject_Impl(iddObject, false, true));
+
+    try {
+      result->parse(tokens, false);
+      result->resizeToMinFields();
+    } catch (...) {
+      return nullptr;
+    }
+
+    if (result->m_iddObject.hasHandleField()) {
+      OS_ASSERT(!result->m_handle.isNull());
+    } else {
+      result->m_handle = openstudio::createUUID();
+    }
+    return result;
+  }
+
   std::ostream& IdfObject_Impl::print(std::ostream& os) const {
     unsigned n = numFields();
     if (n == 0) {
@@ -1336,7 +1387,9 @@ namespace detail {
         }
       } else {
         // field value
-        os << "  " << m_fields[index];
+        const std::string handleText = storesHandle(index) ? toString(m_handle) : std::string();
+        const std::string& text = handleText.empty() ? m_fields[index] : handleText;
+        os << "  " << text;
         // delimiter
         if (isLastField) {
           os << ";";
@@ -1344,7 +1397,7 @@ namespace detail {
           os << ",";
         }
         // field comment
-        int numSpaces = IdfObject::printedFieldSpace() - int(m_fields[index].size());
+        int numSpaces = IdfObject::printedFieldSpace() - int(text.size());
         if (numSpaces > 0) {
           os << std::setw(numSpaces) << " ";
         }
@@ -1400,7 +1453,7 @@ namespace detail {
     unsigned min_n = m_iddObject.numFieldsInDefaultObject();
     unsigned n = numFields();
     if (n < min_n) {
-      m_fields.resize(min_n);
+      m_fields.edit().resize(min_n);
       n = min_n;
     }
     // also make sure extensible groups are whole
@@ -1410,175 +1463,104 @@ namespace detail {
         int groupSize = m_iddObject.properties().numExtensible;
         int modulo = nExtFields % groupSize;
         if (modulo > 0) {
-          m_fields.resize(n + (groupSize - modulo));
+          m_fields.edit().resize(n + (groupSize - modulo));
         }
       }
     }
+    sizeCachedNumbers();
   }
 
   void IdfObject_Impl::parse(const std::string& text, bool getIddFromFactory) {
-    std::string objectType;
-
-    // cut down on this text as we parse
-    std::string parsedText(text);
-
-    // get preceding comments
-    boost::smatch matches;
-    while (boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())) {
-      std::string comment(matches[1].first, matches[1].second);
-      std::string otherText(matches[2].first, matches[2].second);
-      boost::trim_left(otherText);
-
-      // append the comment
-      if (!comment.empty()) {
-        m_comment += "!" + comment + idfRegex::newLinestring();
-      }
-
-      // reduce the parsed text
-      parsedText = otherText;
-    }
+    IdfTokenizer tokenizer(text);
+    IdfObjectTokens tokens;
+    tokenizer.readObject(tokens, false);
+    parse(tokens, getIddFromFactory);
+  }
 
+  void IdfObject_Impl::parse(const IdfObjectTokens& tokens, bool getIddFromFactory) {
     // the first entry will be the object type
-    if (boost::regex_search(parsedText, matches, idfRegex::line())) {
-      objectType = std::string(matches[1].first, matches[1].second);
-      boost::trim(objectType);
-      std::string commentOrOtherText(matches[2].first, matches[2].second);
-      boost::trim_left(commentOrOtherText);
-      std::string otherText(matches[3].first, matches[3].second);
-
-      if (getIddFromFactory) {
-        // find appropriate IddObject in IddFactory
-        OptionalIddObject candidate = IddFactory::instance().getObject(objectType);
-        if (candidate) {
-          m_iddObject = *candidate;
-        } else {
-          LOG(Warn, "IddObject type '" << objectType << "' not found in IddFactory. " << "Reverting to default Catchall object.");
-          OS_ASSERT(m_iddObject.name() == "Catchall");
-          m_fields.push_back(objectType);
-          objectType = "Catchall";
-        }
-      } else {
-        if (!boost::iequals(objectType, m_iddObject.name())) {
-          if (m_iddObject.type() != IddObjectType::Catchall) {
-            LOG(Error, "IdfObject type '" << objectType << "', does not equal its IddObject name '" << m_iddObject.name()
-                                          << "'. Reverting to default Catchall IddObject.");
-          }
-          m_iddObject = IddObject();
-          m_fields.push_back(objectType);
-          objectType = "Catchall";
-        }
-      }
-
-      if (boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine())
-          || boost::regex_match(commentOrOtherText, commentRegex::whitespaceOnlyBlock())) {
-
-        // set comment
-        m_comment += commentOrOtherText;
+    if (!tokens.objectType) {
+      LOG_AND_THROW("Cannot extract an IdfObject type from text '" << tokens.unparsedText << "'");
+    }
+    std::string objectType = toIdfString(*tokens.objectType);
 
-        // reduce the parsed text
-        parsedText = otherText;
+    if (getIddFromFactory) {
+      // find appropriate IddObject in IddFactory
+      OptionalIddObject candidate = IddFactory::instance().getObject(objectType);
+      if (candidate) {
+        m_iddObject = *candidate;
       } else {
-        // reduce the parsed text
-        parsedText = commentOrOtherText + otherText;
+        LOG(Warn, "IddObject type '" << objectType << "' not found in IddFactory. " << "Reverting to default Catchall object.");
+        OS_ASSERT(m_iddObject.name() == "Catchall");
+        m_fields.edit().push_back(objectType);
+        objectType = "Catchall";
       }
-
     } else {
-      LOG_AND_THROW("Cannot extract an IdfObject type from text '" << parsedText << "'");
-    }
-
-    // get trailing comments
-    while (boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())) {
-      std::string comment(matches[1].first, matches[1].second);
-      std::string otherText(matches[2].first, matches[2].second);
-      boost::trim_left(otherText);
-
-      // append the comment
-      if (!comment.empty()) {
-        m_comment += "!" + comment + idfRegex::newLinestring();
+      if (!boost::iequals(objectType, m_iddObject.name())) {
+        if (m_iddObject.type() != IddObjectType::Catchall) {
+          LOG(Error, "IdfObject type '" << objectType << "', does not equal its IddObject name '" << m_iddObject.name()
+                                        << "'. Reverting to default Catchall IddObject.");
+        }
+        m_iddObject = IddObject();
+        m_fields.edit().push_back(objectType);
+        objectType = "Catchall";
       }
-
-      // reduce the parsed text
-      parsedText = otherText;
     }
 
-    // remove trailing whitespace and new lines
-    boost::trim_right(m_comment);
+    // preceding comments, any comment after the object type, and comment lines before the first field
+    m_comment += tokens.comment;
 
     // parse the fields
-    parseFields(parsedText);
+    parseFields(tokens);
+    sizeCachedNumbers();
   }
 
-  void IdfObject_Impl::parseFields(const std::string& text) {
-    // match variables
-    boost::match_results<std::string::const_iterator> matches;
-
-    // cut down on this text as we parse
-    std::string::const_iterator start = text.begin();
-    std::string::const_iterator stop = text.end();
-
+  void IdfObject_Impl::parseFields(const IdfObjectTokens& tokens) {
     // current idd field index
     unsigned iddFieldIndex = 0;
 
-    // parse all the fields
-    while (boost::regex_search(start, stop, matches, idfRegex::line())) {
-      std::string fieldText(matches[1].first, matches[1].second);
-      boost::trim(fieldText);
-      std::string commentOrOtherText(matches[2].first, matches[2].second);
-      boost::trim(commentOrOtherText);
-
-      if (commentOrOtherText.empty() || boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine())) {
-        // reduce the text
-        start = matches[3].first;
-        stop = matches[3].second;
-      } else {
-        // reduce the text; there may be multiple fields on this line
-        start = matches[2].first;
-        stop = matches[3].second;
-
-        // matches[2] is not a comment
-        commentOrOtherText.clear();
-      }
-
+    for (auto it = tokens.fields.begin(), itEnd = tokens.fields.end(); it != itEnd; ++it) {
       // get the idd field
       OptionalIddField iddField = m_iddObject.getField(iddFieldIndex);
 
-      if (iddField) {
+      if (!iddField) {
+        std::stringstream remainingText;
+        for (auto jt = it + 1; jt != itEnd; ++jt) {
+          remainingText << jt->text << ",";
+        }
+        remainingText << tokens.unparsedText;
+        LOG(Error, "IdfObject of type '" << m_iddObject.name() << "' " << "cannot have field index of " << iddFieldIndex << ". "
+                                         << "Cutting off IdfObject field parsing here, with the following text " << "remaining: " << '\n'
+                                         << it->text << '\n'
+                                         << remainingText.str());
+        return;
+      }
 
-        // add this to our fields
-        m_fields.push_back(fieldText);
+      // add this to our fields
+      m_fields.edit().push_back(toIdfString(it->text));
 
-        if (!commentOrOtherText.empty()) {
-          // drop default comments
-          if (!boost::regex_match(commentOrOtherText, commentRegex::editorCommentWhitespaceOnlyLine())) {
-            m_fieldComments.resize(m_fields.size());
-            m_fieldComments.back() = commentOrOtherText;
-          }
-        }
+      if (!it->comment.empty()) {
+        m_fieldComments.resize(m_fields.size());
+        m_fieldComments.back() = it->comment;
+      }
 
-        // keep handle if this is a handle field
-        if (iddField->properties().type == IddFieldType::HandleType) {
-          Handle candidate = toUUID(fieldText);
-          if (!candidate.isNull()) {
-            m_handle = candidate;
+      // keep handle if this is a handle field, the text is only stored if it is not the usual form
+      if (iddField->properties().type == IddFieldType::HandleType) {
+        Handle candidate = toUUID(m_fields.back());
+        if (!candidate.isNull()) {
+          m_handle = candidate;
+          if ((m_fields.size() == 1) && (m_fields.back() == toString(candidate))) {
+            m_fields.edit().back().clear();
           }
         }
-
-      } else {
-        LOG(Error, "IdfObject of type '" << m_iddObject.name() << "' " << "cannot have field index of " << iddFieldIndex << ". "
-                                         << "Cutting off IdfObject field parsing here, with the following text " << "remaining: " << '\n'
-                                         << fieldText << '\n'
-                                         << std::string(start, stop));
-        return;
       }
 
       // increment current idd field index
       ++iddFieldIndex;
-    }  // while line matches
+    }
 
-    std::string unparsedText(start, stop);
-    boost::trim(unparsedText);
-    if (!unparsedText.empty()) {
-      LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: " << '\n' << unparsedText);
+    if (!tokens.unparsedText.empty()) {
+      LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: " << '\n' << tokens.unparsedText);
     }
   }
 
@@ -1586,13 +1568,14 @@ namespace detail {
 
   bool IdfObject_Impl::setIddObject(const IddObject& iddObject) {
     m_iddObject = iddObject;
+    clearCachedNumbers();
     if (m_fields.size() < minFields()) {
-      m_fields.resize(minFields());
+      m_fields.edit().resize(minFields());
     } else {
       // pop any fields that the IddObject does not recognize
       for (unsigned i = 0, n = numFields(); i < n; ++i) {
         if (!(m_iddObject.isNonextensibleField(i) || m_iddObject.isExtensibleField(i))) {
-          m_fields.resize(i);
+          m_fields.edit().resize(i);
           if (m_fieldComments.size() > m_fields.size()) {
             m_fieldComments.resize(i);
           }
@@ -1833,7 +1816,7 @@ namespace detail {
     IddField iddField = *oIddField;
     OS_ASSERT(m_fields.size() > index);
 
-    if (iddField.properties().required && (!iddField.isObjectListField()) && m_fields[index].empty()) {
+    if (iddField.properties().required && (!iddField.isObjectListField()) && m_fields[index].empty() && !storesHandle(index)) {
       return false;
     }
     return true;
@@ -1948,13 +1931,119 @@ namespace detail {
   }
 
   std::vector<std::string> IdfObject_Impl::fields() const {
-    return m_fields;
+    std::vector<std::string> result = m_fields.get();
+    if (storesHandle(0)) {
+      result[0] = toString(m_handle);
+    }
+    return result;
+  }
+
+  bool IdfObject_Impl::storesHandle(unsigned index) const {
+    return (index == 0) && (index < m_fields.size()) && m_fields[index].empty() && !m_handle.isNull() && m_iddObject.hasHandleField();
+  }
+
+  std::string IdfObject_Impl::fieldText(unsigned index) const {
+    if (storesHandle(index)) {
+      return toString(m_handle);
+    }
+    return m_fields[index];
   }
 
   std::vector<std::string> IdfObject_Impl::fieldComments() const {
     return m_fieldComments;
   }
 
+  void IdfObject_Impl::nameFieldChanged(const boost::optional<std::string>& /*oldName*/) {}
+
+  IdfObject_Impl::CachedNumber::CachedNumber(const CachedNumber& other)
+    : state(other.state.load(std::memory_order_acquire)), value(other.value.load(std::memory_order_relaxed)) {}
+
+  IdfObject_Impl::CachedNumber& IdfObject_Impl::CachedNumber::operator=(const CachedNumber& other) {
+    State otherState = other.state.load(std::memory_order_acquire);
+    value.store(other.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    state.store(otherState, std::memory_order_release);
+    return *this;
+  }
+
+  void IdfObject_Impl::truncateFields(unsigned n) {
+    if (n >= m_fields.size()) {
+      return;
+    }
+
+    boost::optional<std::string> oldName;
+    if (OptionalUnsigned nameIndex = m_iddObject.nameFieldIndex()) {
+      if ((*nameIndex >= n) && (*nameIndex < m_fields.size())) {
+        oldName = decodeString(m_fields[*nameIndex]);
+      }
+    }
+
+    m_fields.edit().resize(n);
+    clearCachedNumbers(n);
+    if (m_fieldComments.size() > n) {
+      m_fieldComments.resize(n);
+    }
+
+    if (oldName) {
+      nameFieldChanged(oldName);
+    }
+  }
+
+  void IdfObject_Impl::sizeCachedNumbers() {
+    if (m_cachedNumbers.size() != m_fields.size()) {
+      m_cachedNumbers.resize(m_fields.size());
+    }
+  }
+
+  void IdfObject_Impl::clearCachedNumber(unsigned index) {
+    if (index < m_cachedNumbers.size()) {
+      m_cachedNumbers[index] = CachedNumber();
+    }
+    // fields are often appended just before being assigned
+    sizeCachedNumbers();
+  }
+
+  void IdfObject_Impl::clearCachedNumbers(unsigned index) {
+    if (index < m_cachedNumbers.size()) {
+      m_cachedNumbers.resize(index);
+    }
+    sizeCachedNumbers();
+  }
+
+  boost::optional<double> IdfObject_Impl::cachedNumber(unsigned index) const {
+    if ((index >= m_fields.size()) || (index >= m_cachedNumbers.size())) {
+      return boost::none;
+    }
+
+    CachedNumber& cached = m_cachedNumbers[index];
+    CachedNumber::State state = cached.state.load(std::memory_order_acquire);
+    if (state == CachedNumber::State::Unparsed) {
+      // concurrent callers may all parse the same text, they store the same result
+      state = CachedNumber::State::NotANumber;
+      double value = 0.0;
+      const std::string& text = m_fields[index];
+      if (!text.empty()) {
+        OptionalIddField iddField = m_iddObject.getField(index);
+        if (iddField && ((iddField->properties().type == IddFieldType::RealType) || (iddField->properties().type == IddFieldType::IntegerType))) {
+          // same conversion as getDouble, without the exception for autosize and the like
+          if (boost::conversion::try_lexical_convert(decodeString(text), value)) {
+            state = CachedNumber::State::Parsed;
+          }
+        }
+      }
+      cached.value.store(value, std::memory_order_relaxed);
+      cached.state.store(state, std::memory_order_release);
+      if (state == CachedNumber::State::Parsed) {
+        return value;
+      }
+      return boost::none;
+    }
+
+    if (state == CachedNumber::State::Parsed) {
+      return cached.value.load(std::memory_order_relaxed);
+    }
+    return boost::none;
+  }
+
   std::string IdfObject_Impl::encodeString(const std::string& value) const {
     std::string result;
     for (auto const& s : value) {
@@ -57,6 +57,9 @@ namespace detail {
  *  .clone().
  *
  *  All fields are stored internally as text. Conversions to numeric types may not succeed.
+ *  Numeric conversions are cached per field, and the cache is safe for concurrent use, so
+ *  several threads may call the const getters on the same IdfObject as long as none of them
+ *  modifies it.
  *
  *  Field indexing follows the C/C++ convention: 0, 1, ...
  *
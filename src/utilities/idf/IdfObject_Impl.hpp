@@ -17,6 +17,8 @@
 
 #include <boost/optional.hpp>
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <ostream>
 #include <vector>
@@ -36,6 +38,75 @@ class OSOptionalQuantity;
 // private namespace
 namespace detail {
 
+  struct IdfObjectTokens;
+
+  /** Field text of an IdfObject_Impl. Copies share one vector until either of them is modified, so
+   *  that cloning a Workspace only duplicates the fields of the objects that are edited afterwards.
+   *  Reading mirrors const std::vector<std::string>; edit() gives this copy its own storage and
+   *  returns it for modification. */
+  class SharedFieldVector
+  {
+   public:
+    using value_type = std::string;
+    using size_type = std::vector<std::string>::size_type;
+    using const_iterator = std::vector<std::string>::const_iterator;
+
+    SharedFieldVector() = default;
+
+    explicit SharedFieldVector(std::vector<std::string> fields) : m_data(std::make_shared<std::vector<std::string>>(std::move(fields))) {}
+
+    SharedFieldVector& operator=(std::vector<std::string> fields) {
+      m_data = std::make_shared<std::vector<std::string>>(std::move(fields));
+      return *this;
+    }
+
+    const std::vector<std::string>& get() const {
+      static const std::vector<std::string> noFields;
+      return m_data ? *m_data : noFields;
+    }
+
+    std::vector<std::string>& edit() {
+      if (!m_data) {
+        m_data = std::make_shared<std::vector<std::string>>();
+      } else if (m_data.use_count() > 1) {
+        m_data = std::make_shared<std::vector<std::string>>(*m_data);
+      }
+      return *m_data;
+    }
+
+    /** Returns true if this and other currently use the same storage. */
+    bool sharesStorageWith(const SharedFieldVector& other) const {
+      return m_data && (m_data == other.m_data);
+    }
+
+    size_type size() const {
+      return get().size();
+    }
+
+    bool empty() const {
+      return get().empty();
+    }
+
+    const std::string& operator[](size_type index) const {
+      return get()[index];
+    }
+
+    const std::string& back() const {
+      return get().back();
+    }
+
+    const_iterator begin() const {
+      return get().begin();
+    }
+
+    const_iterator end() const {
+      return get().end();
+    }
+
+   private:
+    std::shared_ptr<std::vector<std::string>> m_data;
+  };
+
   /** Implementation of IdfObject. */
   class UTILITIES_API IdfObject_Impl
     : public std::enable_shared_from_this<IdfObject_Impl>
@@ -55,7 +126,7 @@ namespace detail {
     explicit IdfObject_Impl(const IddObject& iddObject, bool fastName = false);
 
     /** Constructor from underlying data. Used by WorkspaceObject_Impl. */
-    IdfObject_Impl(const Handle& handle, const std::string& comment, const IddObject& iddObject, const StringVector& fields,
+    IdfObject_Impl(const Handle& handle, const std::string& comment, const IddObject& iddObject, const SharedFieldVector& fields,
                    const StringVector& fieldComments);
 
     virtual ~IdfObject_Impl() = default;
@@ -316,6 +387,10 @@ namespace detail {
      *  be invalid at enums::Strictness level None.) */
     static std::shared_ptr<IdfObject_Impl> load(const std::string& text, const IddObject& iddObject);
 
+    /** Constructor from already tokenized text and an explicit iddObject, used by IdfFile to avoid
+     *  re-parsing the text of each object. Returns nullptr if tokens does not contain an object type. */
+    static std::shared_ptr<IdfObject_Impl> load(const IdfObjectTokens& tokens, const IddObject& iddObject);
+
     /** Serialize this object to os as Idf text. */
     std::ostream& print(std::ostream& os) const;
 
@@ -374,8 +449,8 @@ namespace detail {
     // idd object definition
     IddObject m_iddObject;
 
-    // idf fields
-    std::vector<std::string> m_fields;
+    // idf fields. A handle field holding m_handle is stored empty, and rendered by fieldText.
+    SharedFieldVector m_fields;
     std::vector<std::string> m_fieldComments;  // only populated if encounter non-empty, non-default comment
 
     // idf differences
@@ -385,12 +460,36 @@ namespace detail {
 
     std::vector<std::string> fields() const;
 
+    /** Returns true if field index is the handle field, and it holds m_handle rather than text. */
+    bool storesHandle(unsigned index) const;
+
+    /** Returns the text of field index, which must be less than numFields(). */
+    std::string fieldText(unsigned index) const;
+
     std::vector<std::string> fieldComments() const;
 
     virtual OSOptionalQuantity getQuantityFromDouble(unsigned index, boost::optional<double> value, bool returnIP) const;
 
     virtual boost::optional<double> getDoubleFromQuantity(unsigned index, const Quantity& q) const;
 
+    // SETTER HELPERS
+
+    /** Called whenever the name field is written, with the previous (decoded) name if the field
+     *  already existed. Lets WorkspaceObject_Impl keep its Workspace's name index up to date. */
+    virtual void nameFieldChanged(const boost::optional<std::string>& oldName);
+
+    /** Forgets the value parsed by getDouble, getInt or getUnsigned for field index. Must be called
+     *  whenever m_fields[index] is assigned. */
+    void clearCachedNumber(unsigned index);
+
+    /** Forgets the values parsed for fields at or after index. Must be called whenever m_fields
+     *  shrinks, or the meaning of its fields changes. */
+    void clearCachedNumbers(unsigned index = 0);
+
+    /** Shrinks m_fields, m_fieldComments and the number cache to n fields. Calls nameFieldChanged
+     *  if the name field is removed, so that rollbacks keep the Workspace's name index up to date. */
+    void truncateFields(unsigned n);
+
     // QUERY HELPERS
 
     virtual void populateValidityReport(ValidityReport& report, bool checkNames) const;
@@ -403,6 +502,33 @@ namespace detail {
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
 
    private:
+    // Binary value of a Real or Integer field, parsed from m_fields on first access. m_fields remains
+    // the authoritative data. Const getters may fill entries from several threads at once: each entry
+    // is written with atomics, and the vector itself is only resized by non-const member functions.
+    struct CachedNumber
+    {
+      enum class State : unsigned char
+      {
+        Unparsed,
+        NotANumber,  // empty, autosize, not numeric, etc., left to the regular getters
+        Parsed
+      };
+
+      CachedNumber() = default;
+      CachedNumber(const CachedNumber& other);
+      CachedNumber& operator=(const CachedNumber& other);
+
+      // value is stored before state is released, so a reader that acquires Parsed sees the value
+      std::atomic<State> state{State::Unparsed};
+      std::atomic<double> value{0.0};
+    };
+
+    // sized to m_fields by the non-const members that write m_fields, fields past its end are not cached
+    mutable std::vector<CachedNumber> m_cachedNumbers;
+
+    // Grows or shrinks m_cachedNumbers to the size of m_fields.
+    void sizeCachedNumbers();
+
     IdfObject_Impl() = default;
 
     // CONSTRUCTION HELPERS
@@ -419,14 +545,21 @@ namespace detail {
      * warning if the names do not match.) */
     void parse(const std::string& text, bool getIddFromFactory);
 
+    /* Same as above, for text that has already been tokenized. */
+    void parse(const IdfObjectTokens& tokens, bool getIddFromFactory);
+
     // parse fields
-    void parseFields(const std::string& text);
+    void parseFields(const IdfObjectTokens& tokens);
 
     // GETTER AND SETTER HELPERS
 
     /** Set this object's IddObject to iddObject. */
     bool setIddObject(const IddObject& iddObject);
 
+    // Returns the value of field index if it is a Real or Integer field holding a number, parsing
+    // it on first access. Returns none otherwise. Safe to call concurrently with other const members.
+    boost::optional<double> cachedNumber(unsigned index) const;
+
     // remove any indices that are outside m_fields' range
     UnsignedVector trimFieldIndices(const UnsignedVector& indices) const;
 
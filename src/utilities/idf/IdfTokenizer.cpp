@@ -0,0 +1,319 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "IdfTokenizer.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+
+    bool isSpace(char c) {
+      return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') || (c == '\v') || (c == '\f');
+    }
+
+    bool isLineBreak(char c) {
+      return (c == '\n') || (c == '\r');
+    }
+
+    std::string_view trimLeft(std::string_view text) {
+      std::size_t i = 0;
+      while ((i < text.size()) && isSpace(text[i])) {
+        ++i;
+      }
+      return text.substr(i);
+    }
+
+    void trimRight(std::string& text) {
+      std::size_t n = text.size();
+      while ((n > 0) && isSpace(text[n - 1])) {
+        --n;
+      }
+      text.resize(n);
+    }
+
+    // IDF Editor writes "!- Field Name" comments, these are regenerated on print rather than kept
+    bool isEditorComment(std::string_view comment) {
+      return (comment.substr(0, 2) == "!-") && (comment.find('\v') == std::string_view::npos);
+    }
+
+  }  // namespace
+
+  std::string_view trimIdfText(std::string_view text) {
+    text = trimLeft(text);
+    std::size_t n = text.size();
+    while ((n > 0) && isSpace(text[n - 1])) {
+      --n;
+    }
+    return text.substr(0, n);
+  }
+
+  std::string toIdfString(std::string_view text) {
+    std::string result(text);
+    if (result.find('\r') == std::string::npos) {
+      return result;
+    }
+    std::size_t j = 0;
+    for (std::size_t i = 0, n = text.size(); i < n; ++i) {
+      if (text[i] == '\r') {
+        result[j++] = '\n';
+        if ((i + 1 < n) && (text[i + 1] == '\n')) {
+          ++i;
+        }
+      } else {
+        result[j++] = text[i];
+      }
+    }
+    result.resize(j);
+    return result;
+  }
+
+  void IdfObjectTokens::clear() {
+    comment.clear();
+    objectType.reset();
+    objectTypeOnFirstLine = false;
+    fields.clear();
+    unparsedText = std::string_view();
+    complete = false;
+  }
+
+  IdfTokenizer::IdfTokenizer(std::string_view text) : m_text(text), m_pos(0) {}
+
+  bool IdfTokenizer::atEnd() const {
+    return m_pos >= m_text.size();
+  }
+
+  std::size_t IdfTokenizer::position() const {
+    return m_pos;
+  }
+
+  void IdfTokenizer::setPosition(std::size_t position) {
+    m_pos = std::min(position, m_text.size());
+  }
+
+  IdfTokenizer::LineType IdfTokenizer::lineType() const {
+    return lineType(m_pos);
+  }
+
+  std::string_view IdfTokenizer::line() const {
+    return m_text.substr(m_pos, lineEnd(m_pos) - m_pos);
+  }
+
+  std::string_view IdfTokenizer::readLine() {
+    std::size_t e = lineEnd(m_pos);
+    std::string_view result = m_text.substr(m_pos, e - m_pos);
+    m_pos = nextLine(e);
+    return result;
+  }
+
+  void IdfTokenizer::readObject(IdfObjectTokens& tokens, bool stopAtObjectEnd) {
+    tokens.clear();
+    const std::size_t n = m_text.size();
+
+    // comment lines, which may be separated by blank lines; returns the first position of content
+    auto readCommentLines = [this, &tokens, n](std::size_t pos) {
+      while (true) {
+        std::size_t p = skipSpace(pos);
+        if ((p >= n) || (m_text[p] != '!')) {
+          return p;
+        }
+        std::size_t e = lineEnd(p);
+        if (e > p + 1) {
+          tokens.comment += '!';
+          tokens.comment += m_text.substr(p + 1, e - p - 1);
+          tokens.comment += '\n';
+        }
+        pos = nextLine(e);
+      }
+    };
+
+    // the first line that is not a comment, which is where IdfFile found the object
+    std::size_t firstLineStart = m_pos;
+    while ((firstLineStart < n) && (lineType(firstLineStart) == LineType::CommentOnly)) {
+      firstLineStart = nextLine(lineEnd(firstLineStart));
+    }
+    const std::size_t firstLineEnd = lineEnd(firstLineStart);
+
+    std::size_t i = readCommentLines(m_pos);
+
+    std::size_t tokenStart = i;    // start of the current field text, which may span lines
+    std::size_t unparsedStart = i;  // first position not consumed by a field
+    std::size_t stop = n;
+    bool lineEndsObject = false;  // a ';' not preceded by a '!' was found on the current line
+    bool commentOnLine = false;
+
+    while (i < n) {
+      char c = m_text[i];
+
+      if ((c == ',') || (c == ';')) {
+        std::string_view token = trimIdfText(m_text.substr(tokenStart, i - tokenStart));
+        bool isObjectType = !tokens.objectType;
+
+        // only look for the end of the line if the rest of it is blank or a comment, so that long
+        // lines with many fields are scanned once
+        std::size_t p = i + 1;
+        while ((p < n) && isSpace(m_text[p]) && !isLineBreak(m_text[p])) {
+          ++p;
+        }
+        bool restIsComment = (p >= n) || isLineBreak(m_text[p]) || (m_text[p] == '!');
+        std::size_t e = restIsComment ? lineEnd(p) : p;
+        std::string_view rest = m_text.substr(i + 1, e - i - 1);
+        std::string_view trimmedRest = trimIdfText(rest);
+
+        if ((c == ';') && !commentOnLine) {
+          lineEndsObject = true;
+          tokens.complete = true;
+        }
+
+        if (isObjectType) {
+          tokens.objectType = token;
+          tokens.objectTypeOnFirstLine = (i < firstLineEnd);
+          if (!trimmedRest.empty() && restIsComment) {
+            tokens.comment += trimLeft(rest);
+            if (e < n) {
+              tokens.comment += '\n';
+            }
+          }
+        } else {
+          IdfFieldToken field{token, std::string_view()};
+          if (restIsComment && !isEditorComment(trimmedRest)) {
+            field.comment = trimmedRest;
+          }
+          tokens.fields.push_back(field);
+        }
+
+        if (!restIsComment) {
+          // there may be multiple fields on this line
+          i = tokenStart = unparsedStart = i + 1;
+          continue;
+        }
+
+        i = tokenStart = unparsedStart = nextLine(e);
+        if (lineEndsObject && stopAtObjectEnd) {
+          stop = i;
+          break;
+        }
+        lineEndsObject = false;
+        commentOnLine = false;
+
+        if (isObjectType) {
+          // comment lines between the object type and the first field belong to the object
+          i = tokenStart = unparsedStart = readCommentLines(i);
+        }
+        continue;
+      }
+
+      if (c == '!') {
+        // skip the comment, along with any field text it ended; like the regex based parser this
+        // resumes at the next line, or after a form feed (a line separator for boost::regex, but
+        // not for the object end check)
+        std::size_t p = i + 1;
+        while ((p < n) && !isLineBreak(m_text[p]) && (m_text[p] != '\f')) {
+          ++p;
+        }
+        if ((p < n) && (m_text[p] == '\f')) {
+          i = tokenStart = p + 1;
+          commentOnLine = true;
+          continue;
+        }
+        i = tokenStart = nextLine(p);
+        if (lineEndsObject && stopAtObjectEnd) {
+          stop = i;
+          break;
+        }
+        lineEndsObject = false;
+        commentOnLine = false;
+        continue;
+      }
+
+      if (isLineBreak(c)) {
+        i = nextLine(i);
+        if (lineEndsObject && stopAtObjectEnd) {
+          stop = i;
+          break;
+        }
+        lineEndsObject = false;
+        commentOnLine = false;
+        continue;
+      }
+
+      ++i;
+    }
+
+    if (unparsedStart < stop) {
+      tokens.unparsedText = trimIdfText(m_text.substr(unparsedStart, stop - unparsedStart));
+    }
+    trimRight(tokens.comment);
+    m_pos = stop;
+  }
+
+  void IdfTokenizer::skipObject() {
+    const std::size_t n = m_text.size();
+    while (m_pos < n) {
+      // the object ends with the first line on which a ';' comes before any '!'
+      std::size_t e = lineEnd(m_pos);
+      std::size_t p = m_pos;
+      while ((p < e) && (m_text[p] != ';') && (m_text[p] != '!')) {
+        ++p;
+      }
+      m_pos = nextLine(e);
+      if ((p < e) && (m_text[p] == ';')) {
+        break;
+      }
+    }
+  }
+
+  IdfTokenizer::LineType IdfTokenizer::lineType(std::size_t pos) const {
+    std::size_t e = lineEnd(pos);
+
+    std::size_t p = pos;
+    while ((p < e) && ((m_text[p] == ' ') || (m_text[p] == '\t'))) {
+      ++p;
+    }
+    if (p == e) {
+      return LineType::WhitespaceOnly;
+    }
+
+    while ((p < e) && isSpace(m_text[p])) {
+      ++p;
+    }
+    if ((p < e) && (m_text[p] == '!')) {
+      return LineType::CommentOnly;
+    }
+
+    return LineType::Content;
+  }
+
+  std::size_t IdfTokenizer::lineEnd(std::size_t pos) const {
+    const std::size_t n = m_text.size();
+    while ((pos < n) && !isLineBreak(m_text[pos])) {
+      ++pos;
+    }
+    return pos;
+  }
+
+  std::size_t IdfTokenizer::nextLine(std::size_t lineEnd) const {
+    const std::size_t n = m_text.size();
+    if (lineEnd >= n) {
+      return n;
+    }
+    if ((m_text[lineEnd] == '\r') && (lineEnd + 1 < n) && (m_text[lineEnd + 1] == '\n')) {
+      return lineEnd + 2;
+    }
+    return lineEnd + 1;
+  }
+
+  std::size_t IdfTokenizer::skipSpace(std::size_t pos) const {
+    const std::size_t n = m_text.size();
+    while ((pos < n) && isSpace(m_text[pos])) {
+      ++pos;
+    }
+    return pos;
+  }
+
+}  // namespace detail
+}  // namespace openstudio
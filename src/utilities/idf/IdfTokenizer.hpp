@@ -0,0 +1,119 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFTOKENIZER_HPP
+#define UTILITIES_IDF_IDFTOKENIZER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <boost/optional.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** A single field of Idf text: the trimmed field value and its trailing comment (empty if none).
+   *  Both are views into the tokenized text. */
+  struct UTILITIES_API IdfFieldToken
+  {
+    std::string_view text;
+    std::string_view comment;
+  };
+
+  /** The pieces of one IdfObject's text, as produced by IdfTokenizer::readObject. */
+  struct UTILITIES_API IdfObjectTokens
+  {
+    /** Comment lines preceding the object type, plus any comment following the object type on
+     *  its line and on the lines directly below it. Trailing whitespace is removed. */
+    std::string comment;
+
+    /** The object type, if a separator was found. */
+    boost::optional<std::string_view> objectType;
+
+    /** True if the object type was terminated on the first line of the object. */
+    bool objectTypeOnFirstLine = false;
+
+    std::vector<IdfFieldToken> fields;
+
+    /** Trimmed text that followed the last separator without being terminated by one. */
+    std::string_view unparsedText;
+
+    /** True if a line holding a ';' (not preceded by '!') was read. */
+    bool complete = false;
+
+    void clear();
+  };
+
+  /** Single pass, regex-free tokenizer for Idf and Osm text. Lines may end in "\n", "\r\n" or "\r".
+   *
+   *  The tokenizer reproduces the idfRegex based parsing it replaces: fields are separated by ','
+   *  or ';', '!' starts a comment, comments trailing a field are kept unless they are IDF Editor
+   *  style ("!-") comments, and an object ends with the first line containing a ';' that is not
+   *  preceded by a '!'. */
+  class UTILITIES_API IdfTokenizer
+  {
+   public:
+    enum class LineType
+    {
+      CommentOnly,
+      WhitespaceOnly,
+      Content
+    };
+
+    /** The tokenizer does not copy text, which must outlive it. */
+    explicit IdfTokenizer(std::string_view text);
+
+    bool atEnd() const;
+
+    /** Offset of the current position in text. */
+    std::size_t position() const;
+
+    void setPosition(std::size_t position);
+
+    /** Classifies the line starting at the current position. */
+    LineType lineType() const;
+
+    /** Returns the line starting at the current position, without its line ending. */
+    std::string_view line() const;
+
+    /** Returns line() and moves to the start of the next line. */
+    std::string_view readLine();
+
+    /** Reads one object starting at the current position, which may be preceded by comment lines.
+     *  If stopAtObjectEnd, reading stops after the line that ends the object, otherwise all of the
+     *  remaining text is treated as part of the object. */
+    void readObject(IdfObjectTokens& tokens, bool stopAtObjectEnd);
+
+    /** Moves past the object starting at the current position without tokenizing it, stopping
+     *  where readObject(tokens, true) would. Used to find object boundaries quickly. */
+    void skipObject();
+
+   private:
+    LineType lineType(std::size_t pos) const;
+
+    std::size_t lineEnd(std::size_t pos) const;
+
+    std::size_t nextLine(std::size_t lineEnd) const;
+
+    std::size_t skipSpace(std::size_t pos) const;
+
+    std::string_view m_text;
+    std::size_t m_pos;
+  };
+
+  /** Removes leading and trailing whitespace, as boost::trim does in the classic locale. */
+  UTILITIES_API std::string_view trimIdfText(std::string_view text);
+
+  /** Copies a token, converting any "\r\n" or "\r" line endings (only possible in text spanning
+   *  several lines) to "\n". */
+  UTILITIES_API std::string toIdfString(std::string_view text);
+
+}  // namespace detail
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDF_IDFTOKENIZER_HPP
@@ -14,6 +14,8 @@
 #include <resources.hxx>
 #include <utilities/idd/IddEnums.hxx>
 
+#include <boost/algorithm/string/replace.hpp>
+
 #include <iostream>
 #include <sstream>
 
@@ -74,6 +76,87 @@ TEST_F(IdfFixture, IdfFile_Header) {
   file.setHeader(header);
   EXPECT_EQ("! Multi-line \n! Non-comment.", file.header());
 }
+
+TEST_F(IdfFixture, IdfFile_LoadCommentsAndLineEndings) {
+  std::string text = "! File Header\n"
+                     "! Second line\n"
+                     "\n"
+                     "! Just a comment\n"
+                     "\n"
+                     "Version,9.0;\n"
+                     "\n"
+                     "! Timestep should be > 1.\n"
+                     "Timestep, ! After the type\n"
+                     "  ! Before the first field\n"
+                     "  4;                                      !- Number of Timesteps per Hour\n"
+                     "\n"
+                     "Zone,\n"
+                     "  Zone 1,                                 !- Name\n"
+                     "  0, ! Relative North\n"
+                     "  ! Dropped\n"
+                     "  1, 2,\n"
+                     "  3;\n";
+
+  for (const std::string& newLine : {std::string("\r\n"), std::string("\r")}) {
+    std::string otherText = boost::replace_all_copy(text, "\n", newLine);
+
+    for (const std::string& t : {text, otherText}) {
+      std::stringstream ss(t);
+      OptionalIdfFile oFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+      ASSERT_TRUE(oFile);
+      EXPECT_EQ("! File Header\n! Second line", oFile->header());
+
+      IdfObjectVector objects = oFile->objects();
+      ASSERT_EQ(3u, objects.size());
+
+      EXPECT_TRUE(objects[0].iddObject().type() == IddObjectType::CommentOnly);
+      EXPECT_EQ("! Just a comment", objects[0].comment());
+
+      EXPECT_TRUE(objects[1].iddObject().type() == IddObjectType::Timestep);
+      EXPECT_EQ("! Timestep should be > 1.\n! After the type\n! Before the first field", objects[1].comment());
+      EXPECT_EQ(4, objects[1].getInt(0).get());
+      // IDF Editor comments are not kept
+      EXPECT_EQ("", objects[1].fieldComment(0).get());
+
+      EXPECT_TRUE(objects[2].iddObject().type() == IddObjectType::Zone);
+      EXPECT_EQ("Zone 1", objects[2].name().get());
+      EXPECT_EQ("! Relative North", objects[2].fieldComment(1).get());
+      EXPECT_EQ(1.0, objects[2].getDouble(2).get());
+      EXPECT_EQ(2.0, objects[2].getDouble(3).get());
+      EXPECT_EQ(3.0, objects[2].getDouble(4).get());
+
+      ASSERT_TRUE(oFile->versionObject());
+      EXPECT_EQ("9.0", oFile->versionObject()->getString(0).get());
+    }
+  }
+}
+
+TEST_F(IdfFixture, IdfFile_LoadParallel) {
+  openstudio::path path = resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf");
+  IdfObjectVector expectedObjects = epIdfFile.objects();
+  ASSERT_LT(64u, expectedObjects.size());  // more than one chunk of objects
+
+  for (unsigned nThreads : {2u, 4u, 0u}) {
+    OptionalIdfFile oFile = IdfFile::load(path, IddFileType::EnergyPlus, nullptr, nThreads);
+    ASSERT_TRUE(oFile);
+    EXPECT_EQ(epIdfFile.header(), oFile->header());
+    ASSERT_TRUE(oFile->versionObject());
+    EXPECT_EQ(epIdfFile.versionObject()->getString(0).get(), oFile->versionObject()->getString(0).get());
+
+    IdfObjectVector objects = oFile->objects();
+    ASSERT_EQ(expectedObjects.size(), objects.size());
+    for (unsigned i = 0, n = objects.size(); i < n; ++i) {
+      EXPECT_TRUE(expectedObjects[i].iddObject() == objects[i].iddObject());
+      EXPECT_EQ(expectedObjects[i].comment(), objects[i].comment());
+      ASSERT_EQ(expectedObjects[i].numFields(), objects[i].numFields());
+      for (unsigned j = 0, m = objects[i].numFields(); j < m; ++j) {
+        EXPECT_TRUE(expectedObjects[i].getString(j) == objects[i].getString(j));
+        EXPECT_TRUE(expectedObjects[i].fieldComment(j) == objects[i].fieldComment(j));
+      }
+    }
+  }
+}
+
 /*
 TEST_F(IdfFixture, IdfFile_UnixLineEndings) {
   OptionalIdfFile oFile = IdfFile::load(resourcesPath()/toPath("utilities/Idf/UnixLineEndingTest.idf"));
@@ -31,6 +31,7 @@
 #include <limits>
 #include <type_traits>
 #include <sstream>
+#include <thread>
 
 using namespace std;
 using namespace boost;
@@ -1018,3 +1019,113 @@ TEST_F(IdfFixture, IdfObject_initializeFields) {
     EXPECT_EQ(0, intercepter.numOnDataChange);
   }
 }
+
+TEST_F(IdfFixture, IdfObject_NumericFieldsFollowEdits) {
+  // numeric values are parsed once, make sure they follow every kind of change to the fields
+  IdfObject object(IddObjectType::BuildingSurface_Detailed);
+  unsigned n = object.numFields();
+  EXPECT_FALSE(object.pushExtensibleGroup(StringVector{"1.5", "2", "3"}).empty());
+  ASSERT_TRUE(object.getDouble(n));
+  EXPECT_DOUBLE_EQ(1.5, object.getDouble(n).get());
+  EXPECT_EQ(2, object.getInt(n + 1).get());
+  EXPECT_EQ(3u, object.getUnsigned(n + 2).get());
+
+  EXPECT_TRUE(object.setDouble(n, -4.25));
+  EXPECT_DOUBLE_EQ(-4.25, object.getDouble(n).get());
+  EXPECT_FALSE(object.getUnsigned(n));
+  EXPECT_TRUE(object.setString(n + 1, "7.0"));
+  EXPECT_DOUBLE_EQ(7.0, object.getDouble(n + 1).get());
+
+  // pop the group and push an empty one at the same indices
+  EXPECT_FALSE(object.popExtensibleGroup().empty());
+  EXPECT_EQ(n, object.numFields());
+  EXPECT_FALSE(object.getDouble(n));
+  EXPECT_FALSE(object.pushExtensibleGroup().empty());
+  EXPECT_FALSE(object.getDouble(n));
+  EXPECT_FALSE(object.getDouble(n + 1));
+
+  // shift groups by inserting and erasing
+  EXPECT_FALSE(object.pushExtensibleGroup(StringVector{"10", "11", "12"}).empty());
+  EXPECT_FALSE(object.insertExtensibleGroup(0, StringVector{"20", "21", "22"}).empty());
+  EXPECT_DOUBLE_EQ(20.0, object.getDouble(n).get());
+  EXPECT_FALSE(object.getDouble(n + 3));
+  EXPECT_DOUBLE_EQ(10.0, object.getDouble(n + 6).get());
+  EXPECT_FALSE(object.eraseExtensibleGroup(0).empty());
+  EXPECT_FALSE(object.getDouble(n));
+  EXPECT_DOUBLE_EQ(12.0, object.getDouble(n + 5).get());
+
+  // non-numeric text in a numeric field
+  EXPECT_TRUE(object.setString(n, "autocalculate"));
+  EXPECT_FALSE(object.getDouble(n));
+  EXPECT_TRUE(object.setString(n, "0.5"));
+  EXPECT_DOUBLE_EQ(0.5, object.getDouble(n).get());
+}
+
+TEST_F(IdfFixture, IdfObject_NumericFieldsConcurrentReads) {
+  // const getters fill the number cache, several threads may read the same object at once
+  IdfObject object(IddObjectType::BuildingSurface_Detailed);
+  unsigned n = object.numFields();
+  const unsigned nVertices = 64;
+  for (unsigned i = 0; i < nVertices; ++i) {
+    EXPECT_FALSE(object.pushExtensibleGroup(StringVector{std::to_string(i), std::to_string(i + 0.5), "autocalculate"}).empty());
+  }
+
+  const unsigned nThreads = 4;
+  std::vector<unsigned> failures(nThreads, 0);
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < nThreads; ++t) {
+    threads.emplace_back([&object, &failures, n, t]() {
+      for (unsigned i = 0; i < nVertices; ++i) {
+        unsigned index = n + 3 * i;
+        OptionalDouble x = object.getDouble(index);
+        OptionalInt xi = object.getInt(index);
+        OptionalDouble y = object.getDouble(index + 1);
+        if (!x || (*x != i) || !xi || (*xi != static_cast<int>(i)) || !y || (*y != i + 0.5) || object.getDouble(index + 2)) {
+          ++failures[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (unsigned t = 0; t < nThreads; ++t) {
+    EXPECT_EQ(0u, failures[t]);
+  }
+
+  // clones start from the same values
+  IdfObject clone = object.clone();
+  EXPECT_DOUBLE_EQ(nVertices - 0.5, clone.getDouble(n + 3 * (nVertices - 1) + 1).get());
+}
+
+TEST_F(IdfFixture, IdfObject_HandleField) {
+  // the handle field is rendered from the object's handle rather than stored as text
+  IdfObject object(IddObjectType::OS_Building);
+  std::string handleText = toString(object.handle());
+  ASSERT_TRUE(object.getString(0));
+  EXPECT_EQ(handleText, object.getString(0).get());
+  EXPECT_TRUE(object.isValid(StrictnessLevel::None));
+
+  std::stringstream ss;
+  object.print(ss);
+  EXPECT_NE(std::string::npos, ss.str().find(handleText));
+
+  // text round trip keeps the handle
+  OptionalIdfObject loaded = IdfObject::load(ss.str());
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(object.handle(), loaded->handle());
+  EXPECT_EQ(handleText, loaded->getString(0).get());
+
+  // clones get a new handle, and text to match
+  IdfObject clone = object.clone();
+  EXPECT_NE(object.handle(), clone.handle());
+  EXPECT_EQ(toString(clone.handle()), clone.getString(0).get());
+
+  // other text is kept as is, as before
+  std::string otherText = toString(createUUID());
+  EXPECT_TRUE(object.setString(0, otherText));
+  EXPECT_EQ(otherText, object.getString(0).get());
+  EXPECT_EQ(handleText, toString(object.handle()));
+  EXPECT_TRUE(object.setString(0, handleText));
+  EXPECT_EQ(handleText, object.getString(0).get());
+}
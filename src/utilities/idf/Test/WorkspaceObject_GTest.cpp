@@ -488,6 +488,59 @@ TEST_F(IdfFixture, WorkspaceObject_Filter_Sources) {
   EXPECT_EQ(1, sourcesVector.size());
 }
 
+TEST_F(IdfFixture, WorkspaceObject_ManySources) {
+  // enough sources for the reverse pointers to be indexed, then few enough for them not to be
+  Workspace ws(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  OptionalWorkspaceObject node = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject node2 = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  ASSERT_TRUE(node && node2);
+
+  WorkspaceObjectVector spms;
+  for (unsigned i = 0; i < 50; ++i) {
+    OptionalWorkspaceObject spm = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+    ASSERT_TRUE(spm);
+    EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node->handle()));
+    EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanOutletNodeName, node->handle()));
+    spms.push_back(*spm);
+  }
+  EXPECT_EQ(100u, node->numSources());
+  EXPECT_EQ(50u, node->sources().size());
+
+  // repoint every other source, and remove some of the others
+  for (unsigned i = 0; i < 50; i += 2) {
+    EXPECT_TRUE(spms[i].setPointer(OS_SetpointManager_MixedAirFields::FanOutletNodeName, node2->handle()));
+  }
+  EXPECT_EQ(75u, node->numSources());
+  EXPECT_EQ(25u, node2->numSources());
+  for (unsigned i = 1; i < 50; i += 4) {
+    EXPECT_FALSE(spms[i].remove().empty());
+  }
+  EXPECT_EQ(49u, node->numSources());
+  EXPECT_EQ(37u, node->sources().size());
+  for (unsigned i = 0; i < 50; ++i) {
+    if (i % 4 == 1) {
+      continue;
+    }
+    ASSERT_TRUE(spms[i].getTarget(OS_SetpointManager_MixedAirFields::FanInletNodeName));
+    EXPECT_EQ(node->handle(), spms[i].getTarget(OS_SetpointManager_MixedAirFields::FanInletNodeName)->handle());
+  }
+
+  for (unsigned i = 0; i < 50; ++i) {
+    if (i % 4 != 1) {
+      EXPECT_TRUE(spms[i].setString(OS_SetpointManager_MixedAirFields::FanInletNodeName, ""));
+    }
+  }
+  EXPECT_EQ(12u, node->numSources());
+
+  // removing the target nulls the remaining pointers
+  EXPECT_FALSE(node->remove().empty());
+  for (unsigned i = 0; i < 50; ++i) {
+    if (i % 4 == 3) {
+      EXPECT_FALSE(spms[i].getTarget(OS_SetpointManager_MixedAirFields::FanOutletNodeName));
+    }
+  }
+}
+
 TEST_F(IdfFixture, WorkspaceObject_SetDouble_NaN_and_Inf) {
 
   // try with an WorkspaceObject
@@ -21,6 +21,7 @@
 #include <utilities/idd/Building_FieldEnums.hxx>
 #include <utilities/idd/Construction_FieldEnums.hxx>
 #include <utilities/idd/Zone_FieldEnums.hxx>
+#include <utilities/idd/AirflowNetwork_MultiZone_Zone_FieldEnums.hxx>
 #include <utilities/idd/Lights_FieldEnums.hxx>
 #include <utilities/idd/Output_Meter_FieldEnums.hxx>
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
@@ -30,6 +31,7 @@
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/Sizing_Zone_FieldEnums.hxx>
 #include <utilities/idd/OS_WeatherFile_FieldEnums.hxx>
+#include <utilities/idd/OS_Space_FieldEnums.hxx>
 #include "../WorkspaceWatcher.hpp"
 #include "IdfTestQObjects.hpp"
 
@@ -2102,3 +2104,387 @@ TEST_F(IdfFixture, Workspace_getObjects_Type_StringOverload) {
     EXPECT_EQ(expectedErrorMessage, std::string(e.what()));
   }
 }
+
+TEST_F(IdfFixture, Workspace_NameIndex) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  boost::optional<WorkspaceObject> zone1 = ws.addObject(IdfObject(IddObjectType::Zone));
+  boost::optional<WorkspaceObject> zone2 = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone1);
+  ASSERT_TRUE(zone2);
+  EXPECT_EQ("Zone 1", zone1->nameString());
+  EXPECT_EQ("Zone 2", zone2->nameString());
+
+  // lookups are case insensitive
+  EXPECT_EQ(1u, ws.getObjectsByName("zONE 1").size());
+  EXPECT_EQ(2u, ws.getObjectsByName("ZONE", false).size());
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "zone 2"));
+  EXPECT_EQ(zone2->handle(), ws.getObjectByTypeAndName(IddObjectType::Zone, "zone 2")->handle());
+
+  // renaming moves the object in the index
+  EXPECT_TRUE(zone1->setName("Core Zone"));
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone 1").size());
+  EXPECT_EQ(1u, ws.getObjectsByName("core zone").size());
+  EXPECT_EQ(1u, ws.getObjectsByName("Zone", false).size());
+  EXPECT_EQ("Zone 1", ws.nextName(IddObjectType::Zone, true));
+  EXPECT_EQ("Zone 3", ws.nextName(IddObjectType::Zone, false));
+
+  // objects of other types do not take part in the type's naming series
+  boost::optional<WorkspaceObject> zoneList = ws.addObject(IdfObject(IddObjectType::ZoneList));
+  ASSERT_TRUE(zoneList);
+  EXPECT_TRUE(zoneList->setName("Zone 7"));
+  EXPECT_EQ("Zone 3", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 8", ws.nextName("Zone", false));
+  EXPECT_EQ(2u, ws.getObjectsByName("Zone", false).size());
+  EXPECT_EQ(1u, ws.getObjectsByTypeAndName(IddObjectType::Zone, "Zone").size());
+
+  // removal clears the index
+  Handle h = zone2->handle();
+  EXPECT_TRUE(zone2->remove().size() > 0);
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone 2").size());
+  EXPECT_FALSE(ws.getObject(h));
+  EXPECT_EQ("Zone 1", ws.nextName(IddObjectType::Zone, false));
+
+  // index is swapped along with the data
+  Workspace other(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  ws.swap(other);
+  EXPECT_EQ(0u, ws.getObjectsByName("Core Zone").size());
+  EXPECT_EQ(1u, other.getObjectsByName("Core Zone").size());
+}
+
+TEST_F(IdfFixture, Workspace_NameIndexRollback) {
+  // FluidProperties:Temperatures starts out without any fields, not even its name
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  boost::optional<WorkspaceObject> temperatures = ws.addObject(IdfObject(IddObjectType::FluidProperties_Temperatures));
+  ASSERT_TRUE(temperatures);
+  EXPECT_EQ(0u, temperatures->numFields());
+  EXPECT_FALSE(temperatures->name());
+  EXPECT_EQ(0u, ws.getObjectsByName("").size());
+
+  // the invalid value pushes the name field, then rolls it back
+  EXPECT_FALSE(temperatures->setString(3, "not a number"));
+  EXPECT_EQ(0u, temperatures->numFields());
+  EXPECT_FALSE(temperatures->name());
+  EXPECT_EQ(0u, ws.getObjectsByName("").size());
+
+  // a valid value keeps the pushed (empty) name field
+  EXPECT_TRUE(temperatures->setString(3, "2.5"));
+  ASSERT_TRUE(temperatures->name());
+  EXPECT_EQ(1u, ws.getObjectsByName("").size());
+  EXPECT_TRUE(temperatures->setName("Water Temperatures"));
+  EXPECT_EQ(0u, ws.getObjectsByName("").size());
+  EXPECT_EQ(1u, ws.getObjectsByName("water temperatures").size());
+}
+
+TEST_F(IdfFixture, Workspace_ObjectsOfType) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  std::vector<Handle> zones;
+  for (unsigned i = 0; i < 10; ++i) {
+    boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    zones.push_back(zone->handle());
+  }
+  EXPECT_TRUE(ws.addObject(IdfObject(IddObjectType::ZoneList)));
+  EXPECT_EQ(10u, ws.numObjectsOfType(IddObjectType::Zone));
+  EXPECT_EQ(1u, ws.numObjectsOfType(IddObjectType::ZoneList));
+  EXPECT_EQ(0u, ws.numObjectsOfType(IddObjectType::Building));
+
+  auto handlesOfType = [&ws](IddObjectType type) {
+    std::vector<Handle> result;
+    ws.forEachObjectOfType(type, [&result](const std::shared_ptr<detail::WorkspaceObject_Impl>& impl) { result.push_back(impl->handle()); });
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  std::vector<Handle> expected = zones;
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(expected, handlesOfType(IddObjectType::Zone));
+  EXPECT_TRUE(handlesOfType(IddObjectType::Building).empty());
+
+  // removing objects from the front, middle and back of the type's storage
+  for (unsigned i : {0u, 5u, 9u}) {
+    EXPECT_TRUE(ws.removeObject(zones[i]));
+    expected.erase(std::find(expected.begin(), expected.end(), zones[i]));
+  }
+  EXPECT_EQ(7u, ws.numObjectsOfType(IddObjectType::Zone));
+  EXPECT_EQ(expected, handlesOfType(IddObjectType::Zone));
+  std::vector<Handle> byType = getHandles(ws.getObjectsByType(IddObjectType::Zone));
+  std::sort(byType.begin(), byType.end());
+  EXPECT_EQ(expected, byType);
+  EXPECT_EQ(7u, ws.getObjectsByType(ws.iddFile().getObject(IddObjectType::Zone).get()).size());
+
+  // removing several at once
+  EXPECT_TRUE(ws.removeObjects(std::vector<Handle>(expected.begin(), expected.begin() + 2)));
+  expected.erase(expected.begin(), expected.begin() + 2);
+  EXPECT_EQ(5u, ws.numObjectsOfType(IddObjectType::Zone));
+  EXPECT_EQ(expected, handlesOfType(IddObjectType::Zone));
+
+  // sorted objects and handles are concatenated from the types' storage in type order
+  EXPECT_TRUE(ws.addObject(IdfObject(IddObjectType::Building)));
+  auto checkSorted = [&ws]() {
+    std::vector<WorkspaceObject> sortedObjects = ws.objects(true);
+    std::vector<Handle> sortedHandles = ws.handles(true);
+    EXPECT_EQ(ws.numObjects(), sortedObjects.size());
+    EXPECT_EQ(getHandles(sortedObjects), sortedHandles);
+    for (unsigned i = 1; i < sortedObjects.size(); ++i) {
+      EXPECT_FALSE(ws.order().less(sortedObjects[i].iddObject().type(), sortedObjects[i - 1].iddObject().type()));
+    }
+    std::vector<Handle> unsorted = ws.handles(false);
+    std::sort(unsorted.begin(), unsorted.end());
+    std::sort(sortedHandles.begin(), sortedHandles.end());
+    EXPECT_EQ(unsorted, sortedHandles);
+  };
+  // new workspaces keep the objects in the order they were added
+  checkSorted();
+  EXPECT_EQ(IddObjectType(IddObjectType::Building), ws.objects(true).back().iddObject().type());
+
+  ws.order().setOrderByIddEnum();
+  checkSorted();
+  EXPECT_EQ(IddObjectType(IddObjectType::Building), ws.objects(true).front().iddObject().type());
+
+  ws.order().setIddOrder(std::vector<IddObjectType>{IddObjectType::ZoneList, IddObjectType::Zone, IddObjectType::Building});
+  checkSorted();
+  EXPECT_EQ(IddObjectType(IddObjectType::ZoneList), ws.objects(true).front().iddObject().type());
+  EXPECT_EQ(IddObjectType(IddObjectType::Building), ws.objects(true).back().iddObject().type());
+}
+
+TEST_F(IdfFixture, Workspace_ObjectArena) {
+  EXPECT_FALSE(Workspace::useObjectArenaByDefault());
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  EXPECT_FALSE(ws.useObjectArena());
+
+  ws.setUseObjectArena(true);
+  EXPECT_TRUE(ws.useObjectArena());
+  std::vector<WorkspaceObject> zones;
+  for (unsigned i = 0; i < 100; ++i) {
+    boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    zones.push_back(*zone);
+  }
+  std::shared_ptr<detail::WorkspaceObjectArena> arena = ws.getImpl<detail::Workspace_Impl>()->objectArena();
+  ASSERT_TRUE(arena);
+  EXPECT_GT(arena->bytesInUse(), 0u);
+  std::size_t inUse = arena->bytesInUse();
+
+  // removed objects give their blocks back to the arena
+  EXPECT_TRUE(ws.removeObject(zones.back().handle()));
+  zones.pop_back();
+  EXPECT_LT(arena->bytesInUse(), inUse);
+
+  // clones get their own arena
+  Workspace clone = ws.clone();
+  EXPECT_TRUE(clone.useObjectArena());
+  EXPECT_EQ(99u, clone.numObjectsOfType(IddObjectType::Zone));
+  EXPECT_NE(arena, clone.getImpl<detail::Workspace_Impl>()->objectArena());
+
+  // objects keep the arena alive after the workspace lets go of it
+  std::weak_ptr<detail::WorkspaceObjectArena> weakArena = arena;
+  arena.reset();
+  ws.setUseObjectArena(false);
+  EXPECT_FALSE(ws.useObjectArena());
+  EXPECT_TRUE(ws.addObject(IdfObject(IddObjectType::Zone)));
+  EXPECT_FALSE(weakArena.expired());
+  EXPECT_TRUE(ws.removeObjects(getHandles(zones)));
+  EXPECT_FALSE(weakArena.expired());
+  zones.clear();
+  EXPECT_TRUE(weakArena.expired());
+  EXPECT_EQ(1u, ws.numObjectsOfType(IddObjectType::Zone));
+
+  Workspace::setUseObjectArenaByDefault(true);
+  Workspace defaultWs(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  Workspace::setUseObjectArenaByDefault(false);
+  EXPECT_TRUE(defaultWs.useObjectArena());
+}
+
+TEST_F(IdfFixture, Workspace_CloneSharesFields) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  std::vector<Handle> handles;
+  for (unsigned i = 0; i < 10; ++i) {
+    boost::optional<WorkspaceObject> space = ws.addObject(IdfObject(IddObjectType::OS_Space));
+    ASSERT_TRUE(space);
+    EXPECT_TRUE(space->setName("Space " + std::to_string(i)));
+    handles.push_back(space->handle());
+  }
+
+  // clones read the same text as the original, and edits on either side stay on that side
+  Workspace clone = ws.clone(true);
+  Workspace newHandles = ws.clone();
+  for (unsigned i = 0; i < 10; ++i) {
+    EXPECT_EQ("Space " + std::to_string(i), clone.getObject(handles[i])->name().get());
+    EXPECT_EQ(handles[i], toUUID(clone.getObject(handles[i])->getString(0).get()));
+  }
+  for (const WorkspaceObject& space : newHandles.getObjectsByType(IddObjectType::OS_Space)) {
+    EXPECT_EQ(space.handle(), toUUID(space.getString(0).get()));
+    EXPECT_EQ(ws.getObjectsByName(space.name().get()).size(), 1u);
+  }
+
+  EXPECT_TRUE(clone.getObject(handles[0])->setName("Edited in Clone"));
+  EXPECT_TRUE(ws.getObject(handles[1])->setName("Edited in Original"));
+  EXPECT_EQ("Space 0", ws.getObject(handles[0])->name().get());
+  EXPECT_EQ("Edited in Clone", clone.getObject(handles[0])->name().get());
+  EXPECT_EQ("Edited in Original", ws.getObject(handles[1])->name().get());
+  EXPECT_EQ("Space 1", clone.getObject(handles[1])->name().get());
+
+  // same for other fields
+  EXPECT_TRUE(clone.getObject(handles[2])->setDouble(OS_SpaceFields::XOrigin, 10.0));
+  EXPECT_TRUE(ws.getObject(handles[2])->isEmpty(OS_SpaceFields::XOrigin));
+  EXPECT_DOUBLE_EQ(10.0, clone.getObject(handles[2])->getDouble(OS_SpaceFields::XOrigin).get());
+  EXPECT_TRUE(ws.getObject(handles[3])->setDouble(OS_SpaceFields::XOrigin, 20.0));
+  EXPECT_TRUE(clone.getObject(handles[3])->isEmpty(OS_SpaceFields::XOrigin));
+}
+
+TEST_F(IdfFixture, Workspace_CloneNameIndex) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::vector<Handle> zones;
+  for (unsigned i = 0; i < 3; ++i) {
+    boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    zones.push_back(zone->handle());
+  }
+  EXPECT_TRUE(ws.getObject(zones[1])->remove().size() > 0);
+  boost::optional<WorkspaceObject> zoneList = ws.addObject(IdfObject(IddObjectType::ZoneList));
+  ASSERT_TRUE(zoneList);
+  EXPECT_TRUE(zoneList->setName("Zone 7"));
+
+  // clones that keep handles copy the name and reference indices, others rebuild them, either way they match the original
+  for (bool keepHandles : {true, false}) {
+    Workspace clone = ws.clone(keepHandles);
+    EXPECT_EQ(ws.nextName(IddObjectType::Zone, true), clone.nextName(IddObjectType::Zone, true));
+    EXPECT_EQ(ws.nextName(IddObjectType::Zone, false), clone.nextName(IddObjectType::Zone, false));
+    EXPECT_EQ(ws.nextName("Zone", false), clone.nextName("Zone", false));
+    EXPECT_EQ(3u, clone.getObjectsByName("Zone", false).size());
+    EXPECT_EQ(2u, clone.getObjectsByReference("ZoneNames").size());
+    ASSERT_EQ(1u, clone.getObjectsByName("zone 3").size());
+    WorkspaceObject zone3 = clone.getObjectsByName("zone 3")[0];
+    EXPECT_EQ(keepHandles, zone3.handle() == zones[2]);
+    EXPECT_TRUE(clone.getObject(zone3.handle()));
+
+    // the clone's indices follow its own objects
+    EXPECT_TRUE(zone3.setName("Core Zone"));
+    EXPECT_EQ(0u, clone.getObjectsByName("Zone 3").size());
+    EXPECT_EQ(1u, clone.getObjectsByName("core zone").size());
+    EXPECT_EQ(1u, ws.getObjectsByName("Zone 3").size());
+    EXPECT_EQ(0u, ws.getObjectsByName("core zone").size());
+    boost::optional<WorkspaceObject> newZone = clone.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(newZone);
+    EXPECT_EQ("Zone 2", newZone->nameString());
+    EXPECT_EQ(3u, clone.getObjectsByReference("ZoneNames").size());
+    EXPECT_EQ(2u, ws.getObjectsByReference("ZoneNames").size());
+  }
+}
+
+namespace {
+struct BatchSignalCounter : public Nano::Observer
+{
+  unsigned changes = 0;
+  unsigned adds = 0;
+  unsigned removes = 0;
+
+  void change() {
+    ++changes;
+  }
+
+  void objectAdd(const WorkspaceObject& /*object*/, const IddObjectType& /*type*/, const UUID& /*handle*/) {
+    ++adds;
+  }
+
+  void objectRemove(const WorkspaceObject& /*object*/, const IddObjectType& /*type*/, const UUID& /*handle*/) {
+    ++removes;
+  }
+};
+}  // namespace
+
+TEST_F(IdfFixture, Workspace_BatchEdit) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::vector<WorkspaceObject> zones;
+  for (unsigned i = 0; i < 10; ++i) {
+    boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    zones.push_back(*zone);
+  }
+
+  BatchSignalCounter workspaceCounter;
+  std::shared_ptr<detail::Workspace_Impl> impl = ws.getImpl<detail::Workspace_Impl>();
+  impl->onChange.connect<BatchSignalCounter, &BatchSignalCounter::change>(&workspaceCounter);
+  impl->addWorkspaceObject.connect<BatchSignalCounter, &BatchSignalCounter::objectAdd>(&workspaceCounter);
+  impl->removeWorkspaceObject.connect<BatchSignalCounter, &BatchSignalCounter::objectRemove>(&workspaceCounter);
+  BatchSignalCounter zoneCounter;
+  zones[0].getImpl<detail::WorkspaceObject_Impl>()->onChange.connect<BatchSignalCounter, &BatchSignalCounter::change>(&zoneCounter);
+
+  // signals are coalesced, added and removed objects are not reported
+  {
+    Workspace::BatchEdit batch(ws);
+    EXPECT_TRUE(ws.isBatching());
+    EXPECT_EQ(StrictnessLevel::None, ws.strictnessLevel().value());
+    for (unsigned i = 0; i < 10; ++i) {
+      EXPECT_TRUE(zones[i].setDouble(ZoneFields::XOrigin, i));
+      EXPECT_TRUE(zones[i].setDouble(ZoneFields::YOrigin, i));
+    }
+    boost::optional<WorkspaceObject> added = ws.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(added);
+    EXPECT_TRUE(ws.addObject(IdfObject(IddObjectType::Zone)));
+    EXPECT_TRUE(ws.removeObject(added->handle()));
+    EXPECT_EQ(0u, workspaceCounter.changes);
+    EXPECT_EQ(0u, zoneCounter.changes);
+    EXPECT_TRUE(batch.commit());
+  }
+  EXPECT_FALSE(ws.isBatching());
+  EXPECT_EQ(StrictnessLevel::Draft, ws.strictnessLevel().value());
+  EXPECT_EQ(1u, workspaceCounter.changes);
+  EXPECT_EQ(1u, workspaceCounter.adds);
+  EXPECT_EQ(0u, workspaceCounter.removes);
+  EXPECT_EQ(1u, zoneCounter.changes);
+  EXPECT_DOUBLE_EQ(9.0, zones[9].getDouble(ZoneFields::YOrigin).get());
+
+  // validity is checked on commit
+  ws.beginBatch();
+  ws.beginBatch();
+  EXPECT_TRUE(zones[0].setString(ZoneFields::XOrigin, "not a number"));
+  EXPECT_TRUE(ws.commitBatch());
+  EXPECT_TRUE(ws.isBatching());
+  EXPECT_FALSE(ws.commitBatch());
+  EXPECT_FALSE(ws.isBatching());
+  EXPECT_EQ(StrictnessLevel::Minimal, ws.strictnessLevel().value());
+  EXPECT_EQ("not a number", zones[0].getString(ZoneFields::XOrigin).get());
+  EXPECT_TRUE(zones[0].setString(ZoneFields::XOrigin, ""));
+  EXPECT_TRUE(ws.setStrictnessLevel(StrictnessLevel::Draft));
+
+  // forwarded references are re-derived on commit
+  boost::optional<WorkspaceObject> afnZone = ws.addObject(IdfObject(IddObjectType::AirflowNetwork_MultiZone_Zone));
+  ASSERT_TRUE(afnZone);
+  EXPECT_TRUE(afnZone->setPointer(AirflowNetwork_MultiZone_ZoneFields::ZoneName, zones[1].handle()));
+  EXPECT_EQ(1u, ws.getObjectsByReference("AirFlowNetworkMultizoneZones").size());
+  {
+    Workspace::BatchEdit batch(ws);
+    EXPECT_TRUE(afnZone->setPointer(AirflowNetwork_MultiZone_ZoneFields::ZoneName, zones[2].handle()));
+  }
+  std::vector<WorkspaceObject> referenced = ws.getObjectsByReference("AirFlowNetworkMultizoneZones");
+  ASSERT_EQ(1u, referenced.size());
+  EXPECT_EQ(zones[2].handle(), referenced[0].handle());
+
+  // including for targets removed during the batch
+  {
+    Workspace::BatchEdit batch(ws);
+    EXPECT_TRUE(ws.removeObject(zones[2].handle()));
+  }
+  EXPECT_TRUE(ws.getObjectsByReference("AirFlowNetworkMultizoneZones").empty());
+
+  // a StrictnessLevel set during the batch is the one checked on commit
+  {
+    Workspace::BatchEdit batch(ws);
+    EXPECT_TRUE(zones[0].setString(ZoneFields::XOrigin, "not a number"));
+    EXPECT_TRUE(ws.setStrictnessLevel(StrictnessLevel::Minimal));
+    EXPECT_EQ(StrictnessLevel::None, ws.strictnessLevel().value());
+    EXPECT_TRUE(zones[0].setString(ZoneFields::XOrigin, ""));
+    EXPECT_TRUE(batch.commit());
+  }
+  EXPECT_EQ(StrictnessLevel::Minimal, ws.strictnessLevel().value());
+  {
+    Workspace::BatchEdit batch(ws);
+    EXPECT_TRUE(ws.setStrictnessLevel(StrictnessLevel::Draft));
+    EXPECT_TRUE(zones[0].setString(ZoneFields::XOrigin, "not a number"));
+    EXPECT_FALSE(batch.commit());
+  }
+  EXPECT_EQ(StrictnessLevel::Minimal, ws.strictnessLevel().value());
+}
@@ -15,10 +15,14 @@
 #include "../plot/ProgressBar.hpp"
 
 #include "../core/Assert.hpp"
+#include "../core/ASCIIStrings.hpp"
 #include "../core/StringHelpers.hpp"
 
 #include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <unordered_set>
 
 using namespace std;
 using openstudio::istringEqual;  // used for all name comparisons
@@ -33,8 +37,14 @@ namespace detail {
     : m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_objectArena(useObjectArenaByDefault() ? std::make_shared<WorkspaceObjectArena>() : nullptr),
       m_workspaceObjectOrder(std::make_shared<WorkspaceObjectOrder_Impl>(
-        HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })) {
+        HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })),
+      m_batchDepth(0),
+      m_batchStrictnessLevel(StrictnessLevel::None),
+      m_batchStrictnessLevelChanged(false),
+      m_batchChanged(false),
+      m_emittingBatchSignals(false) {
     m_workspaceObjectMap.reserve(1 << 15);
     m_idfReferencesMap.reserve(1 << 15);
   }
@@ -44,8 +54,14 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_objectArena(useObjectArenaByDefault() ? std::make_shared<WorkspaceObjectArena>() : nullptr),
       m_workspaceObjectOrder(std::make_shared<WorkspaceObjectOrder_Impl>(
-        HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })) {
+        HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })),
+      m_batchDepth(0),
+      m_batchStrictnessLevel(StrictnessLevel::None),
+      m_batchStrictnessLevelChanged(false),
+      m_batchChanged(false),
+      m_emittingBatchSignals(false) {
     m_workspaceObjectMap.reserve(1 << 15);
     m_idfReferencesMap.reserve(1 << 15);
   }
@@ -55,8 +71,14 @@ namespace detail {
       m_header(other.m_header),
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_objectArena(other.useObjectArena() ? std::make_shared<WorkspaceObjectArena>() : nullptr),
       m_workspaceObjectOrder(std::make_shared<WorkspaceObjectOrder_Impl>(
-        HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })) {
+        HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })),
+      m_batchDepth(0),
+      m_batchStrictnessLevel(StrictnessLevel::None),
+      m_batchStrictnessLevelChanged(false),
+      m_batchChanged(false),
+      m_emittingBatchSignals(false) {
     // m_workspaceObjectOrder
     OptionalIddObjectTypeVector iddOrderVector = other.order().iddOrder();
     if (iddOrderVector) {
@@ -75,8 +97,14 @@ namespace detail {
       m_header(),  // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_objectArena(other.useObjectArena() ? std::make_shared<WorkspaceObjectArena>() : nullptr),
       m_workspaceObjectOrder(std::make_shared<WorkspaceObjectOrder_Impl>(
-        HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })) {
+        HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })),
+      m_batchDepth(0),
+      m_batchStrictnessLevel(StrictnessLevel::None),
+      m_batchStrictnessLevelChanged(false),
+      m_batchChanged(false),
+      m_emittingBatchSignals(false) {
     // m_workspaceObjectOrder
     OptionalIddObjectTypeVector iddOrderVector = other.order().iddOrder();
     if (iddOrderVector) {
@@ -144,13 +172,18 @@ namespace detail {
     m_workspaceObjectOrder = otherImpl->m_workspaceObjectOrder;
     otherImpl->m_workspaceObjectOrder = twoo;
 
-    IddObjectTypeMap tiotm = m_iddObjectTypeMap;
-    m_iddObjectTypeMap = otherImpl->m_iddObjectTypeMap;
-    otherImpl->m_iddObjectTypeMap = tiotm;
+    m_iddObjectTypeMap.swap(otherImpl->m_iddObjectTypeMap);
+    m_iddObjectTypeSlots.swap(otherImpl->m_iddObjectTypeSlots);
+    m_objectArena.swap(otherImpl->m_objectArena);
 
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
     otherImpl->m_idfReferencesMap = tirm;
+    m_forwardedReferences.swap(otherImpl->m_forwardedReferences);
+
+    m_nameIndex.swap(otherImpl->m_nameIndex);
+    m_baseNameIndex.swap(otherImpl->m_baseNameIndex);
+    m_nameSuffixesByType.swap(otherImpl->m_nameSuffixesByType);
   }
 
   // GETTERS
@@ -207,21 +240,39 @@ namespace detail {
 
     if (sorted) {
       OptionalHandleVector directOrder = order().directOrder();
-      if (directOrder && (directOrder->size() == numObjects())) {
+      if (directOrder) {
+        // walk the order if it lists every object once, the version object may or may not be in it
         WorkspaceObjectVector result;
-        HandleSet setToCheckUniqueness;
+        result.reserve(directOrder->size());
+        std::unordered_set<Handle, boost::hash<boost::uuids::uuid>> setToCheckUniqueness;
+        setToCheckUniqueness.reserve(directOrder->size());
         for (const Handle& h : *directOrder) {
-          OptionalWorkspaceObject owo = getObject(h);
-          std::pair<HandleSet::iterator, bool> insertResult = setToCheckUniqueness.insert(h);
-          if (owo && insertResult.second && (owo->iddObject() != versionIdd.get())) {
-            result.push_back(*owo);
-          } else {
+          auto womIt = m_workspaceObjectMap.find(h);
+          if ((womIt == m_workspaceObjectMap.end()) || !setToCheckUniqueness.insert(h).second) {
             return sort(objects(false));
           }
+          if (womIt->second->iddObject() != versionIdd.get()) {
+            result.push_back(WorkspaceObject(womIt->second));
+          }
+        }
+        if (result.size() == numObjects()) {
+          return result;
+        }
+        return sort(objects(false));
+      }
+
+      // ordered by IddObjectType only, so sorting the types and concatenating their objects is
+      // enough, rather than sorting every object
+      WorkspaceObjectVector result;
+      result.reserve(m_workspaceObjectMap.size());
+      for (IddObjectType type : sortedObjectTypes()) {
+        for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : m_iddObjectTypeMap.find(type)->second) {
+          if (objectImplPtr->iddObject() != versionIdd.get()) {
+            result.push_back(WorkspaceObject(objectImplPtr));
+          }
         }
-        return result;
       }
-      return sort(objects(false));
+      return result;
     }
 
     WorkspaceObjectVector result;
@@ -236,18 +287,43 @@ namespace detail {
 
   std::vector<Handle> Workspace_Impl::handles(bool sorted) const {
     if (sorted) {
+      OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+      if (!versionIdd) {
+        return {};
+      }
+
       OptionalHandleVector directOrder = order().directOrder();
-      if (directOrder && (directOrder->size() == numObjects())) {
-        HandleSet setToCheckUniqueness;
+      if (directOrder) {
+        // same as objects(true)
+        HandleVector result;
+        result.reserve(directOrder->size());
+        std::unordered_set<Handle, boost::hash<boost::uuids::uuid>> setToCheckUniqueness;
+        setToCheckUniqueness.reserve(directOrder->size());
         for (const Handle& h : *directOrder) {
-          std::pair<HandleSet::iterator, bool> insertResult = setToCheckUniqueness.insert(h);
-          if (!insertResult.second) {
+          auto womIt = m_workspaceObjectMap.find(h);
+          if ((womIt == m_workspaceObjectMap.end()) || !setToCheckUniqueness.insert(h).second) {
             return sort(handles(false));
           }
+          if (womIt->second->iddObject() != versionIdd.get()) {
+            result.push_back(h);
+          }
         }
-        return *directOrder;
+        if (result.size() == numObjects()) {
+          return result;
+        }
+        return sort(handles(false));
       }
-      return sort(handles(false));
+
+      HandleVector result;
+      result.reserve(m_workspaceObjectMap.size());
+      for (IddObjectType type : sortedObjectTypes()) {
+        for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : m_iddObjectTypeMap.find(type)->second) {
+          if (objectImplPtr->iddObject() != versionIdd.get()) {
+            result.push_back(objectImplPtr->handle());
+          }
+        }
+      }
+      return result;
     }
 
     HandleVector result;
@@ -263,6 +339,16 @@ namespace detail {
     return result;
   }
 
+  std::vector<IddObjectType> Workspace_Impl::sortedObjectTypes() const {
+    std::vector<IddObjectType> result;
+    result.reserve(m_iddObjectTypeMap.size());
+    for (const IddObjectTypeMap::value_type& p : m_iddObjectTypeMap) {
+      result.push_back(p.first);
+    }
+    std::sort(result.begin(), result.end(), [this](IddObjectType lhs, IddObjectType rhs) { return m_workspaceObjectOrder.less(lhs, rhs); });
+    return result;
+  }
+
   std::vector<WorkspaceObject> Workspace_Impl::objectsWithURLFields() const {
     WorkspaceObjectVector result;
     for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
@@ -312,25 +398,26 @@ namespace detail {
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByName(const std::string& name, bool exactMatch) const {
-    WorkspaceObjectVector result;
+    const WorkspaceObjectMap* objectMap = nullptr;
     if (exactMatch) {
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
-        if (OptionalString candidate = p.second->name()) {
-          if (istringEqual(*candidate, name)) {
-            result.push_back(WorkspaceObject(p.second));
-          }
-        }
+      auto loc = m_nameIndex.find(ascii_to_upper_copy(name));
+      if (loc != m_nameIndex.end()) {
+        objectMap = &loc->second;
       }
     } else {
-      std::string baseName = getBaseName(name);
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
-        if (OptionalString candidate = p.second->name()) {
-          if (baseNamesMatch(baseName, *candidate)) {
-            result.push_back(WorkspaceObject(p.second));
-          }
-        }
+      auto loc = m_baseNameIndex.find(ascii_to_upper_copy(getBaseName(name)));
+      if (loc != m_baseNameIndex.end()) {
+        objectMap = &loc->second.objects;
       }
     }
+    if (!objectMap) {
+      return {};
+    }
+    WorkspaceObjectVector result;
+    result.reserve(objectMap->size());
+    for (const WorkspaceObjectMap::value_type& p : *objectMap) {
+      result.push_back(WorkspaceObject(p.second));
+    }
     return result;
   }
 
@@ -341,40 +428,62 @@ namespace detail {
     }
     std::vector<WorkspaceObject> result;
     result.reserve(loc->second.size());
-    for (auto it = loc->second.begin(); it != loc->second.end(); ++it) {
-      result.push_back(it->second);
+    for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : loc->second) {
+      result.push_back(WorkspaceObject(objectImplPtr));
     }
     return result;
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByType(const IddObject& objectType) const {
+    // objects with the same IddObject share its type, but e.g. UserCustom types hold many IddObjects
     WorkspaceObjectVector result;
-    for (const WorkspaceObject& object : objects()) {
-      if (object.iddObject() == objectType) {
+    auto loc = m_iddObjectTypeMap.find(objectType.type());
+    if (loc == m_iddObjectTypeMap.end()) {
+      return result;
+    }
+    OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+    for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : loc->second) {
+      WorkspaceObject object(objectImplPtr);
+      if ((object.iddObject() == objectType) && (!versionIdd || (object.iddObject() != versionIdd.get()))) {
         result.push_back(object);
       }
     }
     return result;
   }
 
+  void Workspace_Impl::forEachObjectOfType(IddObjectType objectType,
+                                           const std::function<void(const std::shared_ptr<WorkspaceObject_Impl>&)>& f) const {
+    auto loc = m_iddObjectTypeMap.find(objectType);
+    if (loc == m_iddObjectTypeMap.end()) {
+      return;
+    }
+    for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : loc->second) {
+      f(objectImplPtr);
+    }
+  }
+
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const {
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate, name)) {
-        return object;
+    auto loc = m_nameIndex.find(ascii_to_upper_copy(name));
+    if (loc == m_nameIndex.end()) {
+      return boost::none;
+    }
+    for (const WorkspaceObjectMap::value_type& p : loc->second) {
+      if (p.second->iddObject().type() == objectType) {
+        return WorkspaceObject(p.second);
       }
     }
     return boost::none;
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByTypeAndName(IddObjectType objectType, const std::string& name) const {
+    auto loc = m_baseNameIndex.find(ascii_to_upper_copy(getBaseName(name)));
+    if (loc == m_baseNameIndex.end()) {
+      return {};
+    }
     WorkspaceObjectVector result;
-    std::string baseName = getBaseName(name);
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      if (OptionalString candidate = object.name()) {
-        if (baseNamesMatch(baseName, *candidate)) {
-          result.push_back(object);
-        }
+    for (const WorkspaceObjectMap::value_type& p : loc->second.objects) {
+      if (p.second->iddObject().type() == objectType) {
+        result.push_back(WorkspaceObject(p.second));
       }
     }
     return result;
@@ -411,10 +520,16 @@ namespace detail {
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByNameAndReference(const std::string& name,
                                                                                const std::vector<std::string>& referenceNames) const {
-    for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate, name)) {
-        return object;
+    auto loc = m_nameIndex.find(ascii_to_upper_copy(name));
+    if (loc == m_nameIndex.end()) {
+      return boost::none;
+    }
+    for (const WorkspaceObjectMap::value_type& p : loc->second) {
+      for (const std::string& referenceName : referenceNames) {
+        auto irmLoc = m_idfReferencesMap.find(referenceName);
+        if ((irmLoc != m_idfReferencesMap.end()) && (irmLoc->second.find(p.first) != irmLoc->second.end())) {
+          return WorkspaceObject(p.second);
+        }
       }
     }
     return boost::none;
@@ -424,9 +539,31 @@ namespace detail {
     return m_fastNaming;
   }
 
+  std::shared_ptr<WorkspaceObjectArena> Workspace_Impl::objectArena() const {
+    return m_objectArena;
+  }
+
+  bool Workspace_Impl::useObjectArena() const {
+    return static_cast<bool>(m_objectArena);
+  }
+
+  namespace {
+    std::atomic<bool> useObjectArenaByDefaultFlag(false);
+  }
+
+  bool Workspace_Impl::useObjectArenaByDefault() {
+    return useObjectArenaByDefaultFlag.load();
+  }
+
   // SETTERS
 
   bool Workspace_Impl::setStrictnessLevel(StrictnessLevel level) {
+    if (m_batchDepth > 0) {
+      // checked on commit, against everything the batch did
+      m_batchStrictnessLevel = level;
+      m_batchStrictnessLevelChanged = true;
+      return true;
+    }
     if (isValid(level)) {
       m_strictnessLevel = level;
       return true;
@@ -436,13 +573,13 @@ namespace detail {
 
   // Helper function to start the process of adding an object to the workspace.
   std::shared_ptr<WorkspaceObject_Impl> Workspace_Impl::createObject(const IdfObject& object, bool keepHandle) {
-    return WorkspaceObject_ImplPtr(new WorkspaceObject_Impl(object, this, keepHandle));
+    return makeWorkspaceObject<WorkspaceObject_Impl>(m_objectArena, object, this, keepHandle);
   }
 
   // Helper function to start the process of adding a cloned object to the workspace.
   WorkspaceObject_ImplPtr Workspace_Impl::createObject(const std::shared_ptr<WorkspaceObject_Impl>& originalObjectImplPtr, bool keepHandle) {
     OS_ASSERT(originalObjectImplPtr);
-    return WorkspaceObject_ImplPtr(new WorkspaceObject_Impl(*originalObjectImplPtr, this, keepHandle));
+    return makeWorkspaceObject<WorkspaceObject_Impl>(m_objectArena, *originalObjectImplPtr, this, keepHandle);
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::addObjects(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs, bool checkNames) {
@@ -538,7 +675,8 @@ namespace detail {
   std::vector<WorkspaceObject> Workspace_Impl::addClones(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs,
                                                          const HandleMap& oldNewHandleMap, bool collectionClone,
                                                          const std::vector<UHPointer>& pointersIntoWorkspace,
-                                                         const std::vector<HUPointer>& pointersFromWorkspace, bool driverMethod) {
+                                                         const std::vector<HUPointer>& pointersFromWorkspace, bool driverMethod,
+                                                         bool indexNamesAndReferences) {
     int i = 0;
     int N = objectImplPtrs.size();
     if (oldNewHandleMap.empty()) {
@@ -555,7 +693,10 @@ namespace detail {
       newHandles.push_back(ptr->handle());
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(), ptr));
       insertIntoIddObjectTypeMap(ptr);
-      insertIntoIdfReferencesMap(ptr);
+      if (indexNamesAndReferences) {
+        insertIntoIdfReferencesMap(ptr);
+        insertIntoNameIndex(ptr);
+      }
       this->progressValue.nano_emit(++i);
     }
 
@@ -1371,9 +1512,7 @@ namespace detail {
       return true;
     }  // trivially satisfied
 
-    this->removeWorkspaceObject.nano_emit(WorkspaceObject(objectData->objectImplPtr), objectData->objectImplPtr->iddObject().type(),
-                                          objectData->handle);
-    this->removeWorkspaceObjectPtr.nano_emit(objectData->objectImplPtr, objectData->objectImplPtr->iddObject().type(), objectData->handle);
+    emitRemoveWorkspaceObject(objectData->objectImplPtr, objectData->handle);
 
     // actual work of removing from maps--is always successful
     WorkspaceObjectVector sources = nominallyRemoveObject(handle);
@@ -1382,7 +1521,7 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr, sources, removedHandles);
-      this->onChange.nano_emit();
+      change();
       return true;
     } else {
       restoreObject(*objectData);
@@ -1404,10 +1543,8 @@ namespace detail {
       }
     }
 
-    for (SavedWorkspaceObject savedObject : objectData) {
-      this->removeWorkspaceObject.nano_emit(WorkspaceObject(savedObject.objectImplPtr), savedObject.objectImplPtr->iddObject().type(),
-                                            savedObject.handle);
-      this->removeWorkspaceObjectPtr.nano_emit(savedObject.objectImplPtr, savedObject.objectImplPtr->iddObject().type(), savedObject.handle);
+    for (const SavedWorkspaceObject& savedObject : objectData) {
+      emitRemoveWorkspaceObject(savedObject.objectImplPtr, savedObject.handle);
     }
 
     // actual work of removing from maps--is always successful
@@ -1415,7 +1552,7 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData, sources, handles);
-      this->onChange.nano_emit();
+      change();
       return true;
     } else {
       restoreObjects(objectData);
@@ -1433,12 +1570,37 @@ namespace detail {
     // get reference lists and add targetHandle to them (ok if insert fails)
     OptionalIddField iddField = sourceObject.iddObject().getField(index);
     OS_ASSERT(iddField);
-    for (const std::string& referenceName : iddField->properties().references) {
-      m_idfReferencesMap[referenceName].insert(std::make_pair(targetHandle, getObject(targetHandle)->getImpl<WorkspaceObject_Impl>()));
+    const StringVector& references = iddField->properties().references;
+    if (references.empty()) {
+      return;
+    }
+    std::shared_ptr<WorkspaceObject_Impl> targetImpl = getObject(targetHandle)->getImpl<WorkspaceObject_Impl>();
+    std::set<std::string>& forwarded = m_forwardedReferences[targetHandle];
+    for (const std::string& referenceName : references) {
+      m_idfReferencesMap[referenceName].insert(std::make_pair(targetHandle, targetImpl));
+      forwarded.insert(referenceName);
     }
   }
 
+  void Workspace_Impl::updateNameIndex(const Handle& handle, const boost::optional<std::string>& oldName) {
+    auto womIt = m_workspaceObjectMap.find(handle);
+    if (womIt == m_workspaceObjectMap.end()) {
+      // not (yet) in this workspace, will be indexed upon addition
+      return;
+    }
+    if (oldName) {
+      removeFromNameIndex(womIt->second, *oldName);
+    }
+    insertIntoNameIndex(womIt->second);
+  }
+
   void Workspace_Impl::removeForwardedReferences(const Handle& sourceHandle, unsigned index, const WorkspaceObject& targetObject) {
+    if (m_batchDepth > 0) {
+      // checking the other sources of targetObject for every edit is what batches avoid
+      m_batchReferenceTargets.insert(targetObject.handle());
+      return;
+    }
+
     // get source object
     OptionalWorkspaceObject owo = getObject(sourceHandle);
     OS_ASSERT(owo);
@@ -1480,15 +1642,222 @@ namespace detail {
           auto it = m_idfReferencesMap[referenceName].find(targetObject.handle());
           OS_ASSERT(it != m_idfReferencesMap[referenceName].end());
           m_idfReferencesMap[referenceName].erase(it);
+          auto frIt = m_forwardedReferences.find(targetObject.handle());
+          if (frIt != m_forwardedReferences.end()) {
+            frIt->second.erase(referenceName);
+            if (frIt->second.empty()) {
+              m_forwardedReferences.erase(frIt);
+            }
+          }
         }
       }
     }
   }
 
+  void Workspace_Impl::rebuildForwardedReferences(const Handle& targetHandle) {
+    auto frIt = m_forwardedReferences.find(targetHandle);
+    if (frIt == m_forwardedReferences.end()) {
+      return;
+    }
+    auto womIt = m_workspaceObjectMap.find(targetHandle);
+    if (womIt == m_workspaceObjectMap.end()) {
+      // cleaned up with the target
+      return;
+    }
+    const std::shared_ptr<WorkspaceObject_Impl>& targetImpl = womIt->second;
+
+    // reference lists the target belongs to on its own, or through a field pointing to it
+    std::set<std::string> references;
+    for (const std::string& referenceName : targetImpl->iddObject().references()) {
+      references.insert(referenceName);
+    }
+    std::set<std::string> forwarded;
+    for (const WorkspaceObject& source : targetImpl->sources()) {
+      for (unsigned index : source.getSourceIndices(targetHandle)) {
+        OptionalIddField iddField = source.iddObject().getField(index);
+        OS_ASSERT(iddField);
+        for (const std::string& referenceName : iddField->properties().references) {
+          forwarded.insert(referenceName);
+        }
+      }
+    }
+
+    // only the lists the target was forwarded to can have lost it
+    for (const std::string& referenceName : frIt->second) {
+      if ((forwarded.find(referenceName) != forwarded.end()) || (references.find(referenceName) != references.end())) {
+        continue;
+      }
+      auto irmIt = m_idfReferencesMap.find(referenceName);
+      if (irmIt != m_idfReferencesMap.end()) {
+        irmIt->second.erase(targetHandle);
+        if (irmIt->second.empty()) {
+          m_idfReferencesMap.erase(irmIt);
+        }
+      }
+    }
+    if (forwarded.empty()) {
+      m_forwardedReferences.erase(frIt);
+    } else {
+      frIt->second.swap(forwarded);
+    }
+  }
+
   void Workspace_Impl::setFastNaming(bool fastNaming) {
     m_fastNaming = fastNaming;
   }
 
+  void Workspace_Impl::setUseObjectArena(bool useObjectArena) {
+    if (!useObjectArena) {
+      // objects allocated so far keep the arena alive
+      m_objectArena.reset();
+    } else if (!m_objectArena) {
+      m_objectArena = std::make_shared<WorkspaceObjectArena>();
+    }
+  }
+
+  void Workspace_Impl::setUseObjectArenaByDefault(bool useObjectArena) {
+    useObjectArenaByDefaultFlag.store(useObjectArena);
+  }
+
+  // BATCH EDITING
+
+  void Workspace_Impl::beginBatch() {
+    if (m_batchDepth == 0) {
+      m_batchStrictnessLevel = m_strictnessLevel;
+      m_batchStrictnessLevelChanged = false;
+      m_strictnessLevel = StrictnessLevel::None;
+    }
+    ++m_batchDepth;
+  }
+
+  bool Workspace_Impl::commitBatch() {
+    if (m_batchDepth == 0) {
+      LOG(Warn, "commitBatch called without a matching beginBatch.");
+      return true;
+    }
+    if (--m_batchDepth > 0) {
+      return true;
+    }
+
+    // forwarded references, for every target that lost a source during the batch
+    for (const Handle& targetHandle : m_batchReferenceTargets) {
+      rebuildForwardedReferences(targetHandle);
+    }
+    m_batchReferenceTargets.clear();
+
+    std::vector<PendingObjectSignal> objectSignals;
+    objectSignals.swap(m_batchObjectSignals);
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> changedObjects;
+    changedObjects.swap(m_batchChangedObjects);
+
+    // validity. Added objects are checked in full. Edits were checked as they were made (see
+    // WorkspaceObject_Impl::checkBatchDiffs), only objects whose edits did not pass are checked
+    // again here: fields added or removed check the whole object, other edits the edited fields.
+    // A StrictnessLevel set during the batch is checked against the whole workspace instead. If
+    // that fails, fall back to the strictest level the workspace satisfies.
+    const StrictnessLevel level = m_batchStrictnessLevel;
+    auto editedObjectIsValid = [&level](const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+      if (objectImplPtr->handle().isNull()) {
+        // removed
+        return true;
+      }
+      if (!objectImplPtr->m_batchNeedsCheck && (objectImplPtr->m_batchCheckedDiffs == objectImplPtr->m_diffs.size())) {
+        return true;
+      }
+      std::vector<unsigned> indices;
+      for (const IdfObjectDiff& diff : objectImplPtr->m_diffs) {
+        if (boost::optional<unsigned> index = diff.index()) {
+          if (!diff.oldValue() || !diff.newValue()) {
+            return objectImplPtr->isValid(level);
+          }
+          if (std::find(indices.begin(), indices.end(), *index) == indices.end()) {
+            indices.push_back(*index);
+          }
+        }
+      }
+      for (unsigned index : indices) {
+        if ((index < objectImplPtr->numFields()) && !objectImplPtr->fieldDataIsValid(index, level).empty()) {
+          return false;
+        }
+      }
+      return true;
+    };
+    bool result = true;
+    if (m_batchStrictnessLevelChanged) {
+      m_batchStrictnessLevelChanged = false;
+      result = isValid(level);
+    } else {
+      for (const PendingObjectSignal& objectSignal : objectSignals) {
+        if (objectSignal.added && !objectSignal.objectImplPtr->handle().isNull() && !objectSignal.objectImplPtr->isValid(level)) {
+          result = false;
+          break;
+        }
+      }
+      for (auto it = changedObjects.begin(); result && (it != changedObjects.end()); ++it) {
+        result = editedObjectIsValid(*it);
+      }
+    }
+    if (result) {
+      m_strictnessLevel = m_batchStrictnessLevel;
+    } else {
+      LOG(Warn, "Workspace is not valid at StrictnessLevel " << m_batchStrictnessLevel.valueName() << " after batch edit.");
+      StrictnessLevel level = m_batchStrictnessLevel;
+      while ((level > StrictnessLevel::None) && !setStrictnessLevel(level)) {
+        level = StrictnessLevel(level.value() - 1);
+      }
+    }
+
+    // signals, handlers are free to edit the workspace again
+    m_emittingBatchSignals = true;
+    std::set<Handle> added;
+    std::set<Handle> addedAndRemoved;
+    for (const PendingObjectSignal& objectSignal : objectSignals) {
+      if (objectSignal.added) {
+        added.insert(objectSignal.handle);
+      } else if (added.find(objectSignal.handle) != added.end()) {
+        addedAndRemoved.insert(objectSignal.handle);
+      }
+    }
+    for (const PendingObjectSignal& objectSignal : objectSignals) {
+      if (addedAndRemoved.find(objectSignal.handle) != addedAndRemoved.end()) {
+        continue;
+      }
+      if (objectSignal.added) {
+        this->addWorkspaceObject.nano_emit(WorkspaceObject(objectSignal.objectImplPtr), objectSignal.iddObjectType, objectSignal.handle);
+        this->addWorkspaceObjectPtr.nano_emit(objectSignal.objectImplPtr, objectSignal.iddObjectType, objectSignal.handle);
+      } else {
+        this->removeWorkspaceObject.nano_emit(WorkspaceObject(objectSignal.objectImplPtr), objectSignal.iddObjectType, objectSignal.handle);
+        this->removeWorkspaceObjectPtr.nano_emit(objectSignal.objectImplPtr, objectSignal.iddObjectType, objectSignal.handle);
+      }
+    }
+    for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : changedObjects) {
+      if (!objectImplPtr->handle().isNull()) {
+        objectImplPtr->emitChangeSignals();
+      }
+    }
+    m_emittingBatchSignals = false;
+
+    if (m_batchChanged) {
+      m_batchChanged = false;
+      this->onChange.nano_emit();
+    }
+
+    return result;
+  }
+
+  bool Workspace_Impl::isBatching() const {
+    return (m_batchDepth > 0);
+  }
+
+  void Workspace_Impl::deferChangeSignals(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    OS_ASSERT(m_batchDepth > 0);
+    m_batchChangedObjects.push_back(objectImplPtr);
+  }
+
+  StrictnessLevel Workspace_Impl::batchStrictnessLevel() const {
+    return m_batchStrictnessLevel;
+  }
+
   // OBJECT ORDER
 
   WorkspaceObjectOrder Workspace_Impl::order() {
@@ -1510,7 +1879,21 @@ namespace detail {
   // QUERIES
 
   unsigned Workspace_Impl::numObjects() const {
-    return objects().size();
+    OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+    if (!versionIdd) {
+      return 0;
+    }
+    // every object but the version object, without building the vector of objects
+    unsigned result = m_workspaceObjectMap.size();
+    auto iotmLoc = m_iddObjectTypeMap.find(versionIdd->type());
+    if (iotmLoc != m_iddObjectTypeMap.end()) {
+      for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : iotmLoc->second) {
+        if (objectImplPtr->iddObject() == versionIdd.get()) {
+          --result;
+        }
+      }
+    }
+    return result;
   }
 
   unsigned Workspace_Impl::numAllObjects() const {
@@ -1559,8 +1942,12 @@ namespace detail {
       return toString(createUUID());
     }
 
-    WorkspaceObjectVector objectsInSeries = getObjectsByName(name, false);
-    return constructNextName(name, objectsInSeries, fillIn);
+    const NameSuffixes* suffixes = nullptr;
+    auto loc = m_baseNameIndex.find(ascii_to_upper_copy(getBaseName(name)));
+    if (loc != m_baseNameIndex.end()) {
+      suffixes = &loc->second.suffixes;
+    }
+    return constructNextName(name, suffixes, fillIn);
   }
 
   std::string Workspace_Impl::nextName(const IddObjectType& iddObjectType, bool fillIn) const {
@@ -1573,8 +1960,15 @@ namespace detail {
       return {};
     }
     std::string name = iddObjectNameToIdfObjectName(iddObject->name());
-    WorkspaceObjectVector objectsInSeries = getObjectsByTypeAndName(iddObjectType, name);
-    return constructNextName(name, objectsInSeries, fillIn);
+    const NameSuffixes* suffixes = nullptr;
+    auto typeLoc = m_nameSuffixesByType.find(iddObjectType);
+    if (typeLoc != m_nameSuffixesByType.end()) {
+      auto loc = typeLoc->second.find(ascii_to_upper_copy(getBaseName(name)));
+      if (loc != typeLoc->second.end()) {
+        suffixes = &loc->second;
+      }
+    }
+    return constructNextName(name, suffixes, fillIn);
   }
 
   bool Workspace_Impl::isValid() const {
@@ -1776,10 +2170,6 @@ namespace detail {
     return result;
   }
 
-  bool Workspace_Impl::baseNamesMatch(const std::string& baseName, const std::string& objectName) const {
-    return istringEqual(baseName, getBaseName(objectName));
-  }
-
   std::tuple<boost::optional<int>, std::string> Workspace_Impl::getNameSuffix(const std::string& objectName) const {
 
     std::size_t found1 = objectName.find_last_of(' ');
@@ -1922,6 +2312,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(ptr);
 
+    // Name indices
+    insertIntoNameIndex(ptr);
+
     return true;
   }
 
@@ -1930,7 +2323,37 @@ namespace detail {
   }
 
   void Workspace_Impl::insertIntoIddObjectTypeMap(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
-    m_iddObjectTypeMap[objectImplPtr->iddObject().type()].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
+    auto slotLoc = m_iddObjectTypeSlots.find(objectImplPtr->handle());
+    if (slotLoc != m_iddObjectTypeSlots.end()) {
+      // already in the map, do not create an empty entry for its type
+      return;
+    }
+    WorkspaceObjectImplVector& objectsOfType = m_iddObjectTypeMap[objectImplPtr->iddObject().type()];
+    m_iddObjectTypeSlots.insert(slotLoc, std::make_pair(objectImplPtr->handle(), objectsOfType.size()));
+    objectsOfType.push_back(objectImplPtr);
+  }
+
+  void Workspace_Impl::removeFromIddObjectTypeMap(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    auto iotmLoc = m_iddObjectTypeMap.find(objectImplPtr->iddObject().type());
+    OS_ASSERT(iotmLoc != m_iddObjectTypeMap.end());
+    auto slotLoc = m_iddObjectTypeSlots.find(objectImplPtr->handle());
+    OS_ASSERT(slotLoc != m_iddObjectTypeSlots.end());
+    WorkspaceObjectImplVector& objectsOfType = iotmLoc->second;
+    std::size_t slot = slotLoc->second;
+    OS_ASSERT(slot < objectsOfType.size());
+    OS_ASSERT(objectsOfType[slot] == objectImplPtr);
+    m_iddObjectTypeSlots.erase(slotLoc);
+
+    // fill the slot with the last object of the type
+    if (slot + 1 < objectsOfType.size()) {
+      objectsOfType[slot] = objectsOfType.back();
+      m_iddObjectTypeSlots[objectsOfType[slot]->handle()] = slot;
+    }
+    objectsOfType.pop_back();
+    // erase entry if vector is empty
+    if (objectsOfType.empty()) {
+      m_iddObjectTypeMap.erase(iotmLoc);
+    }
   }
 
   void Workspace_Impl::insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
@@ -1939,6 +2362,123 @@ namespace detail {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+
+  void Workspace_Impl::insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    OptionalString name = objectImplPtr->name();
+    if (!name) {
+      return;
+    }
+    Handle handle = objectImplPtr->handle();
+    m_nameIndex[ascii_to_upper_copy(*name)].insert(std::make_pair(handle, objectImplPtr));
+
+    std::string baseName = ascii_to_upper_copy(getBaseName(*name));
+    NameSeries& series = m_baseNameIndex[baseName];
+    series.objects.insert(std::make_pair(handle, objectImplPtr));
+
+    std::tuple<boost::optional<int>, std::string> suffix = getNameSuffix(*name);
+    if (std::get<0>(suffix)) {
+      bool underscore = (std::get<1>(suffix) == "_");
+      series.suffixes.insert(*std::get<0>(suffix), underscore);
+      m_nameSuffixesByType[objectImplPtr->iddObject().type()][baseName].insert(*std::get<0>(suffix), underscore);
+    }
+  }
+
+  void Workspace_Impl::copyNameAndReferenceIndices(const Workspace_Impl& other,
+                                                   const std::unordered_map<const WorkspaceObject_Impl*, std::shared_ptr<WorkspaceObject_Impl>>& clones) {
+    // the clones keep their handles, so the maps are copied as they are and only the objects are swapped for their clones
+    auto swapInClones = [&clones](WorkspaceObjectMap& objects) {
+      for (WorkspaceObjectMap::value_type& p : objects) {
+        auto it = clones.find(p.second.get());
+        OS_ASSERT(it != clones.end());
+        OS_ASSERT(it->second->handle() == p.first);
+        p.second = it->second;
+      }
+    };
+
+    m_idfReferencesMap = other.m_idfReferencesMap;
+    for (IdfReferencesMap::value_type& p : m_idfReferencesMap) {
+      swapInClones(p.second);
+    }
+    m_forwardedReferences = other.m_forwardedReferences;
+
+    m_nameIndex = other.m_nameIndex;
+    for (NameIndexMap::value_type& p : m_nameIndex) {
+      swapInClones(p.second);
+    }
+
+    m_baseNameIndex = other.m_baseNameIndex;
+    for (BaseNameIndexMap::value_type& p : m_baseNameIndex) {
+      swapInClones(p.second.objects);
+    }
+
+    m_nameSuffixesByType = other.m_nameSuffixesByType;
+  }
+
+  void Workspace_Impl::removeFromNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr, const std::string& name) {
+    Handle handle = objectImplPtr->handle();
+    auto nameLoc = m_nameIndex.find(ascii_to_upper_copy(name));
+    if (nameLoc != m_nameIndex.end()) {
+      nameLoc->second.erase(handle);
+      // erase entry if set is empty
+      if (nameLoc->second.empty()) {
+        m_nameIndex.erase(nameLoc);
+      }
+    }
+
+    std::string baseName = ascii_to_upper_copy(getBaseName(name));
+    auto seriesLoc = m_baseNameIndex.find(baseName);
+    if ((seriesLoc == m_baseNameIndex.end()) || (seriesLoc->second.objects.erase(handle) == 0)) {
+      return;
+    }
+
+    std::tuple<boost::optional<int>, std::string> suffix = getNameSuffix(name);
+    if (std::get<0>(suffix)) {
+      bool underscore = (std::get<1>(suffix) == "_");
+      seriesLoc->second.suffixes.erase(*std::get<0>(suffix), underscore);
+      auto typeLoc = m_nameSuffixesByType.find(objectImplPtr->iddObject().type());
+      if (typeLoc != m_nameSuffixesByType.end()) {
+        auto loc = typeLoc->second.find(baseName);
+        if (loc != typeLoc->second.end()) {
+          loc->second.erase(*std::get<0>(suffix), underscore);
+          if (loc->second.uses.empty()) {
+            typeLoc->second.erase(loc);
+          }
+        }
+      }
+    }
+    if (seriesLoc->second.objects.empty()) {
+      m_baseNameIndex.erase(seriesLoc);
+    }
+  }
+
+  void Workspace_Impl::NameSuffixes::insert(int suffix, bool underscore) {
+    SuffixUse& use = uses[suffix];
+    ++use.count;
+    if (underscore) {
+      ++use.underscores;
+    }
+    if (suffix == firstUnused) {
+      while (uses.find(firstUnused) != uses.end()) {
+        ++firstUnused;
+      }
+    }
+  }
+
+  void Workspace_Impl::NameSuffixes::erase(int suffix, bool underscore) {
+    auto it = uses.find(suffix);
+    if (it == uses.end()) {
+      return;
+    }
+    if (underscore && (it->second.underscores > 0)) {
+      --it->second.underscores;
+    }
+    if (--it->second.count == 0) {
+      uses.erase(it);
+      if (suffix < firstUnused) {
+        firstUnused = suffix;
+      }
+    }
+  }
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2116,6 +2656,11 @@ namespace detail {
       }
     }
 
+    // Name indices
+    if (OptionalString name = objectImplPtr->name()) {
+      removeFromNameIndex(objectImplPtr, *name);
+    }
+
     // IdfReferencesMap
     StringVector references = objectImplPtr->iddObject().references();
     for (const std::string& reference : references) {
@@ -2129,17 +2674,23 @@ namespace detail {
         m_idfReferencesMap.erase(irmLoc);
       }
     }
+    // references forwarded to the object, left behind if its sources were unlinked during a batch
+    auto frIt = m_forwardedReferences.find(handle);
+    if (frIt != m_forwardedReferences.end()) {
+      for (const std::string& reference : frIt->second) {
+        auto irmLoc = m_idfReferencesMap.find(reference);
+        if (irmLoc != m_idfReferencesMap.end()) {
+          irmLoc->second.erase(handle);
+          if (irmLoc->second.empty()) {
+            m_idfReferencesMap.erase(irmLoc);
+          }
+        }
+      }
+      m_forwardedReferences.erase(frIt);
+    }
 
     // IddObjectTypeMap
-    auto iotmLoc = m_iddObjectTypeMap.find(objectImplPtr->iddObject().type());
-    OS_ASSERT(iotmLoc != m_iddObjectTypeMap.end());
-    auto loc = iotmLoc->second.find(handle);
-    OS_ASSERT(loc != iotmLoc->second.end());
-    iotmLoc->second.erase(loc);
-    // erase entry if set is empty
-    if (iotmLoc->second.empty()) {
-      m_iddObjectTypeMap.erase(iotmLoc);
-    }
+    removeFromIddObjectTypeMap(objectImplPtr);
 
     // WorkspaceObjectOrder
     if (m_workspaceObjectOrder.isDirectOrder()) {
@@ -2184,10 +2735,26 @@ namespace detail {
 
   void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object) {
     object.getImpl<WorkspaceObject_Impl>().get()->WorkspaceObject_Impl::onChange.connect<Workspace_Impl, &Workspace_Impl::change>(this);
-    auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
-    this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
-    this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
-    this->onChange.nano_emit();
+    emitAddWorkspaceObject(object.getImpl<WorkspaceObject_Impl>());
+    change();
+  }
+
+  void Workspace_Impl::emitAddWorkspaceObject(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    if (m_batchDepth > 0) {
+      m_batchObjectSignals.push_back(PendingObjectSignal{true, objectImplPtr, objectImplPtr->iddObject().type(), objectImplPtr->handle()});
+      return;
+    }
+    this->addWorkspaceObject.nano_emit(WorkspaceObject(objectImplPtr), objectImplPtr->iddObject().type(), objectImplPtr->handle());
+    this->addWorkspaceObjectPtr.nano_emit(objectImplPtr, objectImplPtr->iddObject().type(), objectImplPtr->handle());
+  }
+
+  void Workspace_Impl::emitRemoveWorkspaceObject(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr, const Handle& handle) {
+    if (m_batchDepth > 0) {
+      m_batchObjectSignals.push_back(PendingObjectSignal{false, objectImplPtr, objectImplPtr->iddObject().type(), handle});
+      return;
+    }
+    this->removeWorkspaceObject.nano_emit(WorkspaceObject(objectImplPtr), objectImplPtr->iddObject().type(), handle);
+    this->removeWorkspaceObjectPtr.nano_emit(objectImplPtr, objectImplPtr->iddObject().type(), handle);
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2205,6 +2772,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(savedObject.objectImplPtr);
 
+    // Name indices
+    insertIntoNameIndex(savedObject.objectImplPtr);
+
     // Fix Pointers
     savedObject.objectImplPtr->restorePointers();
 
@@ -2223,37 +2793,21 @@ namespace detail {
 
   // QUERIES
 
-  std::string Workspace_Impl::constructNextName(const std::string& objectName, const std::vector<WorkspaceObject>& objectsInTheSeries,
-                                                bool fillIn) const {
-    vector<int> takenValues;
-    std::tuple<boost::optional<int>, std::string> takenSuffix;
-    for (const WorkspaceObject& object : objectsInTheSeries) {
-      takenSuffix = getNameSuffix(*(object.name()));
-      if (std::get<0>(takenSuffix)) {
-        takenValues.push_back(*std::get<0>(takenSuffix));
-      }
-    }
-    std::sort(takenValues.begin(), takenValues.end());
-    takenValues.erase(std::unique(takenValues.begin(), takenValues.end()), takenValues.end());
-
+  std::string Workspace_Impl::constructNextName(const std::string& objectName, const NameSuffixes* suffixes, bool fillIn) const {
     int suffix(1);
-    if (fillIn) {
-      for (int usedSuffix : takenValues) {
-        if (usedSuffix == suffix) {
-          ++suffix;
-        } else {
-          break;
-        }
+    std::string spacer = " ";
+    if (suffixes && !suffixes->uses.empty()) {
+      if (fillIn) {
+        suffix = suffixes->firstUnused;
+      } else {
+        suffix = suffixes->uses.rbegin()->first + 1;
       }
-    } else {
-      if (!takenValues.empty()) {
-        suffix = *(takenValues.rbegin()) + 1;
+      // follow the spacer convention of the highest suffix in the series
+      const SuffixUse& lastUse = suffixes->uses.rbegin()->second;
+      if (lastUse.underscores == lastUse.count) {
+        spacer = "_";
       }
     }
-    std::string spacer = std::get<1>(takenSuffix);
-    if (spacer.empty()) {
-      spacer = " ";
-    }
     return getBaseName(objectName) + spacer + boost::lexical_cast<std::string>(suffix);
   }
 
@@ -2320,22 +2874,33 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    if ((m_batchDepth > 0) || m_emittingBatchSignals) {
+      m_batchChanged = true;
+      return;
+    }
     this->onChange.nano_emit();
   }
 
   void Workspace_Impl::createAndAddClonedObjects(const std::shared_ptr<detail::Workspace_Impl>& /*thisImpl*/,
                                                  std::shared_ptr<detail::Workspace_Impl> cloneImpl, bool keepHandles) const {
     detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs;
+    newObjectImplPtrs.reserve(m_workspaceObjectMap.size());
+    std::unordered_map<const WorkspaceObject_Impl*, WorkspaceObject_ImplPtr> clones;
     HandleMap oldNewHandleMap;
-    for (const WorkspaceObject& object : allObjects()) {
-      newObjectImplPtrs.push_back(cloneImpl->createObject(object.getImpl<detail::WorkspaceObject_Impl>(), keepHandles));
-      Handle h = newObjectImplPtrs.back()->handle();
-      if (!keepHandles) {
-        oldNewHandleMap.insert(HandleMap::value_type(object.handle(), h));
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      newObjectImplPtrs.push_back(cloneImpl->createObject(p.second, keepHandles));
+      if (keepHandles) {
+        clones.emplace(p.second.get(), newObjectImplPtrs.back());
+      } else {
+        oldNewHandleMap.insert(HandleMap::value_type(p.first, newObjectImplPtrs.back()->handle()));
       }
     }
+    // the clone has the same names and handles, copy the name and reference indices rather than rebuilding them
+    if (keepHandles) {
+      cloneImpl->copyNameAndReferenceIndices(*this, clones);
+    }
     // add Object_ImplPtrs to clone's Workspace_Impl
-    cloneImpl->addClones(newObjectImplPtrs, oldNewHandleMap, true);
+    cloneImpl->addClones(newObjectImplPtrs, oldNewHandleMap, true, UHPointerVector(), HUPointerVector(), true, !keepHandles);
   }
 
   void Workspace_Impl::createAndAddSubsetClonedObjects(const std::shared_ptr<detail::Workspace_Impl>& thisImpl,
@@ -2497,6 +3062,11 @@ std::vector<WorkspaceObject> Workspace::getObjectsByType(const IddObject& object
   return m_impl->getObjectsByType(objectType);
 }
 
+void Workspace::forEachObjectOfType(IddObjectType objectType,
+                                    const std::function<void(const std::shared_ptr<detail::WorkspaceObject_Impl>&)>& f) const {
+  m_impl->forEachObjectOfType(objectType, f);
+}
+
 boost::optional<WorkspaceObject> Workspace::getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const {
   return m_impl->getObjectByTypeAndName(objectType, name);
 }
@@ -2521,6 +3091,14 @@ bool Workspace::fastNaming() const {
   return m_impl->fastNaming();
 }
 
+bool Workspace::useObjectArena() const {
+  return m_impl->useObjectArena();
+}
+
+bool Workspace::useObjectArenaByDefault() {
+  return detail::Workspace_Impl::useObjectArenaByDefault();
+}
+
 // SETTERS
 
 bool Workspace::setStrictnessLevel(StrictnessLevel level) {
@@ -2582,6 +3160,44 @@ void Workspace::setFastNaming(bool fastNaming) {
   m_impl->setFastNaming(fastNaming);
 }
 
+void Workspace::beginBatch() {
+  m_impl->beginBatch();
+}
+
+bool Workspace::commitBatch() {
+  return m_impl->commitBatch();
+}
+
+bool Workspace::isBatching() const {
+  return m_impl->isBatching();
+}
+
+Workspace::BatchEdit::BatchEdit(Workspace& workspace) : m_workspace(workspace), m_open(true) {
+  m_workspace.beginBatch();
+}
+
+Workspace::BatchEdit::~BatchEdit() {
+  if (m_open) {
+    m_workspace.commitBatch();
+  }
+}
+
+bool Workspace::BatchEdit::commit() {
+  if (!m_open) {
+    return true;
+  }
+  m_open = false;
+  return m_workspace.commitBatch();
+}
+
+void Workspace::setUseObjectArena(bool useObjectArena) {
+  m_impl->setUseObjectArena(useObjectArena);
+}
+
+void Workspace::setUseObjectArenaByDefault(bool useObjectArena) {
+  detail::Workspace_Impl::setUseObjectArenaByDefault(useObjectArena);
+}
+
 // ORDER
 
 WorkspaceObjectOrder Workspace::order() {
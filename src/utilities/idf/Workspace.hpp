@@ -13,6 +13,8 @@
 #include "../core/Logger.hpp"
 #include "../core/Path.hpp"
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <ostream>
 #include <vector>
@@ -181,6 +183,11 @@ class UTILITIES_API Workspace
   /** Returns all objects with .iddObject() == objectType. */
   std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+  /** Calls f with the implementation of each object of type objectType, in no particular order.
+   *  Unlike getObjectsByType, does not construct a WorkspaceObject for each object. f must not add
+   *  or remove objects. */
+  void forEachObjectOfType(IddObjectType objectType, const std::function<void(const std::shared_ptr<detail::WorkspaceObject_Impl>&)>& f) const;
+
   /** Returns the first object found of type objectType and named name (case insensitive,
    *  exact match). */
   boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const;
@@ -210,13 +217,22 @@ class UTILITIES_API Workspace
    *  objects and does not do any name conflict checking. */
   bool fastNaming() const;
 
+  /** Returns true if new objects are allocated from an arena owned by this Workspace rather than
+   *  one by one on the heap. */
+  bool useObjectArena() const;
+
+  /** Returns true if newly constructed Workspaces (including those created by loading a file)
+   *  allocate their objects from an arena. Defaults to false. */
+  static bool useObjectArenaByDefault();
+
   //@}
   /** @name Setters */
   //@{
 
   /** Set the StrictnessLevel to level. If level > strictnessLevel(), this method may
    *  leave the strictness unchanged and return false to indicate that the collection does not
-   *  satisfy those requirements. To diagnose any issues, print the validityReport(level). */
+   *  satisfy those requirements. To diagnose any issues, print the validityReport(level). During a
+   *  batch, level replaces the one the batch is committed at and is only checked by commitBatch. */
   bool setStrictnessLevel(StrictnessLevel level);
 
   /** Add a clone of idfObject to Workspace. May rename the new object to avoid name
@@ -316,6 +332,46 @@ class UTILITIES_API Workspace
    *  handle. */
   void setFastNaming(bool fastNaming);
 
+  /** Turn arena allocation of new objects on or off. Arena allocation packs the objects of a
+   *  Workspace together and frees them in bulk once the last of them is destroyed, at the cost of
+   *  not returning the memory of individually removed objects to the system. Existing objects are
+   *  not moved. Clones inherit the setting. */
+  void setUseObjectArena(bool useObjectArena);
+
+  /** Set whether newly constructed Workspaces allocate their objects from an arena. */
+  static void setUseObjectArenaByDefault(bool useObjectArena);
+
+  //@}
+  /** @name Batch Editing */
+  //@{
+
+  class BatchEdit;
+
+  /** Start a batch of edits. Until the matching commitBatch:
+   *  \li the Workspace operates at StrictnessLevel::None, so individual edits are not checked;
+   *  \li object change signals are held back, and each edited object emits them once on commit;
+   *  \li object add and remove signals are queued and sent on commit, objects that were both added
+   *      and removed during the batch are not reported at all;
+   *  \li removing a pointer no longer re-derives which reference lists its target belongs to, this
+   *      is done once per affected target on commit. Until then, lookups by reference may still
+   *      find such targets.
+   *
+   *  Batches nest, only the outermost commitBatch takes effect. Prefer BatchEdit, which cannot be
+   *  left open. */
+  void beginBatch();
+
+  /** Close the batch started by beginBatch. Checks each object added or edited during the batch
+   *  once, at the StrictnessLevel in effect when the batch started (edits are checked as they are
+   *  made, while the object is at hand). If setStrictnessLevel was called during the batch, checks
+   *  the whole Workspace at the last level set instead. If they are all valid, sets that level and
+   *  returns true. Otherwise, logs a warning, sets the StrictnessLevel to the highest
+   *  level at which the Workspace is valid and returns false; the edits are kept. Signals are
+   *  emitted after the validity check. */
+  bool commitBatch();
+
+  /** Returns true if a batch of edits is open. */
+  bool isBatching() const;
+
   //@}
   /** @name Object Order */
   //@{
@@ -472,6 +528,37 @@ class UTILITIES_API Workspace
   std::shared_ptr<detail::Workspace_Impl> m_impl;
 };
 
+/** Scope for a batch of edits to a Workspace, see Workspace::beginBatch. The batch is committed by
+ *  commit, or on destruction if commit was not called.
+ *
+ *  \code
+ *  {
+ *    Workspace::BatchEdit batch(workspace);
+ *    for (WorkspaceObject& surface : surfaces) {
+ *      surface.setPointer(constructionIndex, construction.handle());
+ *    }
+ *    bool valid = batch.commit();
+ *  }
+ *  \endcode */
+class UTILITIES_API Workspace::BatchEdit
+{
+ public:
+  explicit BatchEdit(Workspace& workspace);
+
+  ~BatchEdit();
+
+  BatchEdit(const BatchEdit& other) = delete;
+  BatchEdit& operator=(const BatchEdit& other) = delete;
+
+  /** Commit the batch, returns the result of Workspace::commitBatch. Does nothing and returns true
+   *  if already committed. */
+  bool commit();
+
+ private:
+  Workspace m_workspace;
+  bool m_open;
+};
+
 /** \relates Workspace */
 using OptionalWorkspace = boost::optional<Workspace>;
 
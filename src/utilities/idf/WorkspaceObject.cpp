@@ -17,6 +17,8 @@
 #include "../core/Assert.hpp"
 #include "../core/StringHelpers.hpp"
 
+#include <boost/functional/hash.hpp>
+
 using namespace std;
 
 using openstudio::detail::WorkspaceObject_Impl;
@@ -26,11 +28,85 @@ namespace openstudio {
 
 namespace detail {
 
+  ReversePointerSet::const_iterator ReversePointerSet::begin() const {
+    return m_pointers.begin();
+  }
+
+  ReversePointerSet::const_iterator ReversePointerSet::end() const {
+    return m_pointers.end();
+  }
+
+  std::size_t ReversePointerSet::size() const {
+    return m_pointers.size();
+  }
+
+  bool ReversePointerSet::empty() const {
+    return m_pointers.empty();
+  }
+
+  ReversePointerSet::const_iterator ReversePointerSet::find(const ReversePointer& ptr) const {
+    if (m_index.empty()) {
+      return std::find_if(m_pointers.begin(), m_pointers.end(), [&ptr](const ReversePointer& other) { return EqualTo()(ptr, other); });
+    }
+    auto it = m_index.find(ptr);
+    if (it == m_index.end()) {
+      return m_pointers.end();
+    }
+    return m_pointers.begin() + it->second;
+  }
+
+  std::pair<ReversePointerSet::const_iterator, bool> ReversePointerSet::insert(const ReversePointer& ptr) {
+    auto it = find(ptr);
+    if (it != m_pointers.end()) {
+      return {it, false};
+    }
+
+    m_pointers.push_back(ptr);
+    if (!m_index.empty()) {
+      m_index.emplace(ptr, m_pointers.size() - 1);
+    } else if (m_pointers.size() >= indexThreshold) {
+      for (std::size_t i = 0, n = m_pointers.size(); i < n; ++i) {
+        m_index.emplace(m_pointers[i], i);
+      }
+    }
+    return {m_pointers.end() - 1, true};
+  }
+
+  void ReversePointerSet::erase(const_iterator it) {
+    OS_ASSERT(it != m_pointers.end());
+    auto i = static_cast<std::size_t>(it - m_pointers.begin());
+    std::size_t last = m_pointers.size() - 1;
+    if (!m_index.empty()) {
+      m_index.erase(m_pointers[i]);
+      if (i != last) {
+        m_index[m_pointers[last]] = i;
+      }
+    }
+    if (i != last) {
+      m_pointers[i] = m_pointers[last];
+    }
+    m_pointers.pop_back();
+
+    // drop the index once the set is well below the threshold, so that it is not rebuilt repeatedly
+    if (!m_index.empty() && (m_pointers.size() < indexThreshold / 2)) {
+      m_index.clear();
+    }
+  }
+
+  std::size_t ReversePointerSet::Hash::operator()(const ReversePointer& ptr) const {
+    std::size_t result = boost::hash<boost::uuids::uuid>()(ptr.sourceHandle);
+    boost::hash_combine(result, ptr.fieldIndex);
+    return result;
+  }
+
   // CONSTRUCTORS
 
   WorkspaceObject_Impl::WorkspaceObject_Impl(const IdfObject& idfObject, Workspace_Impl* workspace, bool keepHandle)
     : IdfObject_Impl(*(idfObject.getImpl<detail::IdfObject_Impl>()), keepHandle),  // clones idfObject data
       m_initialized(false),
+      m_changeSignalsDeferred(false),
+      m_batchCheckedDiffs(0),
+      m_batchNeedsCheck(false),
       m_workspace(workspace) {
     if (!m_iddObject.objectLists().empty()) {
       // can nominally be source
@@ -45,6 +121,9 @@ namespace detail {
   WorkspaceObject_Impl::WorkspaceObject_Impl(const WorkspaceObject_Impl& other, Workspace_Impl* workspace, bool keepHandle)
     : IdfObject_Impl(other, keepHandle),
       m_initialized(false),
+      m_changeSignalsDeferred(false),
+      m_batchCheckedDiffs(0),
+      m_batchNeedsCheck(false),
       m_workspace(workspace),
       m_sourceData(other.m_sourceData),
       m_targetData(other.m_targetData) {}
@@ -927,40 +1006,61 @@ namespace detail {
       return;
     }
 
+    // diffs keep accumulating until the workspace's batch commits
+    if (m_workspace && !m_handle.isNull() && m_workspace->isBatching()) {
+      if (!m_changeSignalsDeferred) {
+        std::shared_ptr<IdfObject_Impl> self = weak_from_this().lock();
+        if (!self) {
+          // still being constructed, added objects are checked in full on commit
+          return;
+        }
+        m_changeSignalsDeferred = true;
+        m_batchCheckedDiffs = 0;
+        m_batchNeedsCheck = false;
+        m_workspace->deferChangeSignals(std::static_pointer_cast<WorkspaceObject_Impl>(self));
+      }
+      checkBatchDiffs();
+      return;
+    }
+    m_changeSignalsDeferred = false;
+
     bool nameChange = false;
     bool dataChange = false;
 
-    for (const IdfObjectDiff& diff : m_diffs) {
+    // the diffs only need a walk if somebody listens to which fields changed
+    if (!(onRelationshipChange.empty() && onNameChange.empty() && onDataChange.empty())) {
+      for (const IdfObjectDiff& diff : m_diffs) {
 
-      if (diff.isNull()) {
-        continue;
-      }
+        if (diff.isNull()) {
+          continue;
+        }
 
-      boost::optional<unsigned> index = diff.index();
-      if (index) {
+        boost::optional<unsigned> index = diff.index();
+        if (index) {
 
-        OptionalIddField oIddField = iddObject().getField(*index);
+          OptionalIddField oIddField = iddObject().getField(*index);
 
-        if (oIddField && oIddField->isObjectListField() && diff.optionalCast<WorkspaceObjectDiff>()) {
+          if (oIddField && oIddField->isObjectListField() && diff.optionalCast<WorkspaceObjectDiff>()) {
 
-          auto workspaceObjectDiff = diff.cast<WorkspaceObjectDiff>();
+            auto workspaceObjectDiff = diff.cast<WorkspaceObjectDiff>();
 
-          Handle newHandle;
-          if (workspaceObjectDiff.newHandle()) {
-            newHandle = workspaceObjectDiff.newHandle().get();
-          }
+            Handle newHandle;
+            if (workspaceObjectDiff.newHandle()) {
+              newHandle = workspaceObjectDiff.newHandle().get();
+            }
 
-          Handle oldHandle;
-          if (workspaceObjectDiff.oldHandle()) {
-            oldHandle = workspaceObjectDiff.oldHandle().get();
-          }
+            Handle oldHandle;
+            if (workspaceObjectDiff.oldHandle()) {
+              oldHandle = workspaceObjectDiff.oldHandle().get();
+            }
 
-          this->onRelationshipChange.nano_emit(*index, newHandle, oldHandle);
+            this->onRelationshipChange.nano_emit(*index, newHandle, oldHandle);
 
-        } else if (oIddField && oIddField->isNameField()) {
-          nameChange = true;
-        } else {
-          dataChange = true;
+          } else if (oIddField && oIddField->isNameField()) {
+            nameChange = true;
+          } else {
+            dataChange = true;
+          }
         }
       }
     }
@@ -978,6 +1078,28 @@ namespace detail {
     m_diffs.clear();
   }
 
+  void WorkspaceObject_Impl::checkBatchDiffs() {
+    if (m_diffs.size() < m_batchCheckedDiffs) {
+      // rolled back past what was checked
+      m_batchNeedsCheck = true;
+    }
+    if (!m_batchNeedsCheck) {
+      const StrictnessLevel level = m_workspace->batchStrictnessLevel();
+      for (auto it = m_diffs.begin() + m_batchCheckedDiffs, itEnd = m_diffs.end(); it != itEnd; ++it) {
+        boost::optional<unsigned> index = it->index();
+        if (!index) {
+          continue;
+        }
+        // fields added or removed, or a value that may yet be fixed before the commit
+        if (!it->oldValue() || !it->newValue() || (*index >= numFields()) || !fieldDataIsValid(*index, level).empty()) {
+          m_batchNeedsCheck = true;
+          break;
+        }
+      }
+    }
+    m_batchCheckedDiffs = m_diffs.size();
+  }
+
   // PROTECTED
 
   void WorkspaceObject_Impl::setInitialized() {
@@ -986,6 +1108,11 @@ namespace detail {
 
   void WorkspaceObject_Impl::disconnect() {
     this->onRemoveFromWorkspace.nano_emit(m_handle);
+    m_changeSignalsDeferred = false;
+    // keep the handle field text, which is rendered from m_handle while connected
+    if (storesHandle(0)) {
+      m_fields.edit()[0] = toString(m_handle);
+    }
     m_handle = Handle();
     m_workspace = nullptr;
   }
@@ -1055,7 +1182,9 @@ namespace detail {
       }
     }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
+      // setting a source's pointer may add to this object's reverse pointers, iterate over a copy
+      ReversePointerSet reversePointers = m_targetData->reversePointers;
+      for (const ReversePointer& ptr : reversePointers) {
         OptionalWorkspaceObject source = m_workspace->getObject(ptr.sourceHandle);
         if (source) {
           OptionalWorkspaceObject oTarget = source->getTarget(ptr.fieldIndex);
@@ -1071,6 +1200,12 @@ namespace detail {
     }
   }
 
+  void WorkspaceObject_Impl::nameFieldChanged(const boost::optional<std::string>& oldName) {
+    if (m_workspace && !m_handle.isNull()) {
+      m_workspace->updateNameIndex(m_handle, oldName);
+    }
+  }
+
   // PRIVATE
 
   // SETTERS
@@ -1175,11 +1310,8 @@ namespace detail {
     // last field must be nonextensible, and final size must satisfy minimum number of fields
     if ((index >= minFields()) && (numExtensibleGroups() == 0)) {
       // delete field
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], boost::none));
-      m_fields.pop_back();
-      if (m_fieldComments.size() > m_fields.size()) {
-        m_fieldComments.resize(m_fields.size());
-      }
+      m_diffs.push_back(IdfObjectDiff(index, fieldText(index), boost::none));
+      truncateFields(index);
     } else {
       return false;
     }
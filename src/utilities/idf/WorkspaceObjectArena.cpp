@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "WorkspaceObjectArena.hpp"
+
+#include <new>
+
+namespace openstudio {
+namespace detail {
+
+  WorkspaceObjectArena::WorkspaceObjectArena() : m_cursor(nullptr), m_end(nullptr), m_bytesInUse(0) {
+    m_freeLists.fill(nullptr);
+  }
+
+  WorkspaceObjectArena::~WorkspaceObjectArena() {
+    for (char* chunk : m_chunks) {
+      ::operator delete(chunk);
+    }
+  }
+
+  void* WorkspaceObjectArena::allocate(std::size_t bytes) {
+    if (bytes == 0) {
+      bytes = 1;
+    }
+    if (bytes > maxPooledSize) {
+      void* result = ::operator new(bytes);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_bytesInUse += bytes;
+      return result;
+    }
+
+    std::size_t index = sizeClass(bytes);
+    std::size_t blockSize = (index + 1) * granularity;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bytesInUse += blockSize;
+    if (FreeBlock* block = m_freeLists[index]) {
+      m_freeLists[index] = block->next;
+      return block;
+    }
+    if (static_cast<std::size_t>(m_end - m_cursor) < blockSize) {
+      // the tail of the current chunk is abandoned, it is at most maxPooledSize bytes
+      m_chunks.reserve(m_chunks.size() + 1);
+      auto* chunk = static_cast<char*>(::operator new(chunkSize));
+      m_chunks.push_back(chunk);
+      m_cursor = chunk;
+      m_end = chunk + chunkSize;
+    }
+    void* result = m_cursor;
+    m_cursor += blockSize;
+    return result;
+  }
+
+  void WorkspaceObjectArena::deallocate(void* p, std::size_t bytes) noexcept {
+    if (!p) {
+      return;
+    }
+    if (bytes == 0) {
+      bytes = 1;
+    }
+    if (bytes > maxPooledSize) {
+      ::operator delete(p);
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_bytesInUse -= bytes;
+      return;
+    }
+
+    std::size_t index = sizeClass(bytes);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bytesInUse -= (index + 1) * granularity;
+    auto* block = static_cast<FreeBlock*>(p);
+    block->next = m_freeLists[index];
+    m_freeLists[index] = block;
+  }
+
+  std::size_t WorkspaceObjectArena::bytesReserved() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_chunks.size() * chunkSize;
+  }
+
+  std::size_t WorkspaceObjectArena::bytesInUse() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bytesInUse;
+  }
+
+}  // namespace detail
+}  // namespace openstudio
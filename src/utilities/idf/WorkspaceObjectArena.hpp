@@ -0,0 +1,126 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_WORKSPACEOBJECTARENA_HPP
+#define UTILITIES_IDF_WORKSPACEOBJECTARENA_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** Pool that serves the object impls of a single Workspace. Blocks are carved from large chunks
+   *  and recycled through per-size free lists, so that the many small, same-sized allocations made
+   *  while loading a model land next to each other and are released together when the last object
+   *  that uses the arena goes away. Requests larger than maxPooledSize are passed to operator new.
+   *  Thread-safe. */
+  class UTILITIES_API WorkspaceObjectArena
+  {
+   public:
+    /// allocation granularity, and the strongest alignment the arena can provide
+    static constexpr std::size_t granularity = alignof(std::max_align_t);
+
+    /// largest request served from the chunks
+    static constexpr std::size_t maxPooledSize = 64 * granularity;
+
+    /// size of each chunk requested from operator new
+    static constexpr std::size_t chunkSize = 1 << 18;
+
+    WorkspaceObjectArena();
+
+    ~WorkspaceObjectArena();
+
+    WorkspaceObjectArena(const WorkspaceObjectArena& other) = delete;
+    WorkspaceObjectArena& operator=(const WorkspaceObjectArena& other) = delete;
+
+    void* allocate(std::size_t bytes);
+
+    void deallocate(void* p, std::size_t bytes) noexcept;
+
+    /// bytes obtained from operator new for chunks, regardless of how much is in use
+    std::size_t bytesReserved() const;
+
+    /// bytes currently handed out, including requests passed through to operator new
+    std::size_t bytesInUse() const;
+
+   private:
+    struct FreeBlock
+    {
+      FreeBlock* next;
+    };
+
+    static std::size_t sizeClass(std::size_t bytes) {
+      return (bytes + granularity - 1) / granularity - 1;
+    }
+
+    mutable std::mutex m_mutex;
+    std::vector<char*> m_chunks;
+    char* m_cursor;
+    char* m_end;
+    std::array<FreeBlock*, maxPooledSize / granularity> m_freeLists;
+    std::size_t m_bytesInUse;
+  };
+
+  /** Standard allocator over a WorkspaceObjectArena. Each copy shares ownership of the arena, so
+   *  that objects allocated with std::allocate_shared keep it alive after their Workspace is gone. */
+  template <class T>
+  class WorkspaceObjectArenaAllocator
+  {
+   public:
+    static_assert(alignof(T) <= WorkspaceObjectArena::granularity, "WorkspaceObjectArena does not support over-aligned types");
+
+    using value_type = T;
+
+    explicit WorkspaceObjectArenaAllocator(std::shared_ptr<WorkspaceObjectArena> arena) noexcept : m_arena(std::move(arena)) {}
+
+    template <class U>
+    WorkspaceObjectArenaAllocator(const WorkspaceObjectArenaAllocator<U>& other) noexcept : m_arena(other.arena()) {}
+
+    T* allocate(std::size_t n) {
+      return static_cast<T*>(m_arena->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+      m_arena->deallocate(p, n * sizeof(T));
+    }
+
+    const std::shared_ptr<WorkspaceObjectArena>& arena() const noexcept {
+      return m_arena;
+    }
+
+    template <class U>
+    bool operator==(const WorkspaceObjectArenaAllocator<U>& other) const noexcept {
+      return m_arena == other.arena();
+    }
+
+    template <class U>
+    bool operator!=(const WorkspaceObjectArenaAllocator<U>& other) const noexcept {
+      return m_arena != other.arena();
+    }
+
+   private:
+    std::shared_ptr<WorkspaceObjectArena> m_arena;
+  };
+
+  /** Construct an object impl in arena if there is one, otherwise on the regular heap. */
+  template <class T, class... Args>
+  std::shared_ptr<T> makeWorkspaceObject(const std::shared_ptr<WorkspaceObjectArena>& arena, Args&&... args) {
+    if (arena) {
+      return std::allocate_shared<T>(WorkspaceObjectArenaAllocator<T>(arena), std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+
+}  // namespace detail
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDF_WORKSPACEOBJECTARENA_HPP
@@ -10,6 +10,7 @@
 #include "../math/Permutation.hpp"
 
 #include <iterator>
+#include <unordered_map>
 
 namespace openstudio {
 
@@ -178,12 +179,18 @@ namespace detail {
   }
 
   std::vector<Handle> WorkspaceObjectOrder_Impl::sort(const std::vector<Handle>& handles) const {
+    if (m_directOrder && (handles.size() > 1)) {
+      return sortByDirectOrder(handles, handles);
+    }
     HandleVector result(handles);
     std::sort(result.begin(), result.end(), [this](const auto& lhs, const auto& rhs) { return less(lhs, rhs); });
     return result;
   }
 
   std::vector<WorkspaceObject> WorkspaceObjectOrder_Impl::sort(const std::vector<WorkspaceObject>& objects) const {
+    if (m_directOrder && (objects.size() > 1)) {
+      return sortByDirectOrder(objects, getHandles<WorkspaceObject>(objects));
+    }
     WorkspaceObjectVector result(objects);
     std::sort(result.begin(), result.end(), [this](const auto& lhs, const auto& rhs) { return less(lhs, rhs); });
     return result;
@@ -287,6 +294,34 @@ namespace detail {
     return std::find(m_directOrder->begin(), m_directOrder->end(), object.handle());
   }
 
+  template <typename T>
+  std::vector<T> WorkspaceObjectOrder_Impl::sortByDirectOrder(const std::vector<T>& items, const std::vector<Handle>& handles) const {
+    OS_ASSERT(m_directOrder);
+    OS_ASSERT(items.size() == handles.size());
+
+    // position of each handle in the order, looked up once rather than searched for in every comparison.
+    // handles that are not in the order go last, as with less.
+    std::unordered_map<Handle, std::size_t, boost::hash<boost::uuids::uuid>> positions;
+    positions.reserve(m_directOrder->size());
+    for (std::size_t i = 0, n = m_directOrder->size(); i < n; ++i) {
+      positions.emplace((*m_directOrder)[i], i);
+    }
+    std::vector<std::pair<std::size_t, std::size_t>> keys;  // (position in order, index in items)
+    keys.reserve(items.size());
+    for (std::size_t i = 0, n = handles.size(); i < n; ++i) {
+      auto it = positions.find(handles[i]);
+      keys.emplace_back((it == positions.end()) ? m_directOrder->size() : it->second, i);
+    }
+    std::sort(keys.begin(), keys.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    std::vector<T> result;
+    result.reserve(items.size());
+    for (const auto& key : keys) {
+      result.push_back(items[key.second]);
+    }
+    return result;
+  }
+
   boost::optional<IddObjectType> WorkspaceObjectOrder_Impl::getIddObjectType(const Handle& handle) const {
     OS_ASSERT(m_objectGetter);
     OptionalWorkspaceObject object = m_objectGetter(handle);
@@ -400,6 +435,10 @@ bool WorkspaceObjectOrder::erase(const Handle& handle) {
 
 // SORTING
 
+bool WorkspaceObjectOrder::less(IddObjectType left, IddObjectType right) const {
+  return m_impl->less(left, right);
+}
+
 std::vector<Handle> WorkspaceObjectOrder::sort(const std::vector<Handle>& handles) const {
   return m_impl->sort(handles);
 }
@@ -117,6 +117,10 @@ namespace detail {
 
     boost::optional<IddObjectType> getIddObjectType(const Handle& handle) const;
 
+    // only call when m_directOrder == true. handles[i] is the handle of items[i].
+    template <typename T>
+    std::vector<T> sortByDirectOrder(const std::vector<T>& items, const std::vector<Handle>& handles) const;
+
     // returns empty vector if can't convert all.
     WorkspaceObjectVector getObjects(const std::vector<Handle>& handles) const;
   };
@@ -203,6 +207,10 @@ class UTILITIES_API WorkspaceObjectOrder
 
   // SORTING
 
+  /** Returns whether objects of type left come before objects of type right. Only meaningful if
+   *  not direct ordered. */
+  bool less(IddObjectType left, IddObjectType right) const;
+
   std::vector<Handle> sort(const std::vector<Handle>& handles) const;
 
   std::vector<openstudio::WorkspaceObject> sort(const std::vector<openstudio::WorkspaceObject>& objects) const;
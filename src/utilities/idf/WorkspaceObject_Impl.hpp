@@ -12,6 +12,11 @@
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
+#include <boost/container/flat_set.hpp>
+#include <boost/container/small_vector.hpp>
+
+#include <unordered_map>
+
 namespace openstudio {
 
 // forward declarations
@@ -32,7 +37,9 @@ namespace detail {
     ForwardPointer() : fieldIndex(0) {}
     ForwardPointer(unsigned i, const Handle& h) : fieldIndex(i), targetHandle(h) {}
   };
-  using ForwardPointerSet = std::set<ForwardPointer, FieldIndexLess<ForwardPointer>>;
+  /** Sorted by field index. Most objects have a handful of pointer fields, which are stored inline. */
+  using ForwardPointerSet =
+    boost::container::flat_set<ForwardPointer, FieldIndexLess<ForwardPointer>, boost::container::small_vector<ForwardPointer, 4>>;
 
   struct UTILITIES_API SourceData
   {
@@ -63,7 +70,51 @@ namespace detail {
       }
     }
   };
-  using ReversePointerSet = std::set<ReversePointer, ReversePointerLess>;
+
+  /** The reverse pointers of an object, in no particular order. Objects such as schedules and
+   *  constructions can have thousands of sources, so pointers are erased by moving the last one
+   *  into their place, and large sets are indexed by hash. Inserting and erasing invalidate
+   *  iterators. */
+  class UTILITIES_API ReversePointerSet
+  {
+   public:
+    using value_type = ReversePointer;
+    using const_iterator = std::vector<ReversePointer>::const_iterator;
+    using iterator = const_iterator;
+
+    const_iterator begin() const;
+
+    const_iterator end() const;
+
+    std::size_t size() const;
+
+    bool empty() const;
+
+    const_iterator find(const ReversePointer& ptr) const;
+
+    std::pair<const_iterator, bool> insert(const ReversePointer& ptr);
+
+    void erase(const_iterator it);
+
+   private:
+    struct Hash
+    {
+      std::size_t operator()(const ReversePointer& ptr) const;
+    };
+
+    struct EqualTo
+    {
+      bool operator()(const ReversePointer& left, const ReversePointer& right) const {
+        return (left.fieldIndex == right.fieldIndex) && (left.sourceHandle == right.sourceHandle);
+      }
+    };
+
+    // sets smaller than this are searched linearly
+    static constexpr std::size_t indexThreshold = 32;
+
+    std::vector<ReversePointer> m_pointers;
+    std::unordered_map<ReversePointer, std::size_t, Hash, EqualTo> m_index;  // position in m_pointers, empty if not indexed
+  };
 
   struct UTILITIES_API TargetData
   {
@@ -86,6 +137,18 @@ namespace detail {
                         [fieldIndex](const auto& ptr_type) { return fieldIndexEqualTo<typename T::pointer_type>(ptr_type, fieldIndex); });
   }
 
+  /** Forward pointers are sorted by field index, binary search. */
+  template <>
+  inline SourceData::pointer_set::iterator getIteratorAtFieldIndex<SourceData>(SourceData::pointer_set& pointerSet, unsigned fieldIndex) {
+    return pointerSet.find(ForwardPointer(fieldIndex, Handle()));
+  }
+
+  template <>
+  inline SourceData::pointer_set::const_iterator getConstIteratorAtFieldIndex<SourceData>(const SourceData::pointer_set& pointerSet,
+                                                                                         unsigned fieldIndex) {
+    return pointerSet.find(ForwardPointer(fieldIndex, Handle()));
+  }
+
   class UTILITIES_API WorkspaceObject_Impl : public IdfObject_Impl
   {
    public:
@@ -297,6 +360,11 @@ namespace detail {
      *  objects. */
     void restorePointers();
 
+    // SETTER HELPERS
+
+    /** Keeps the Workspace's name index current. */
+    virtual void nameFieldChanged(const boost::optional<std::string>& oldName) override;
+
     // QUERY HELPERS
 
     virtual void populateValidityReport(ValidityReport& report, bool checkNames) const override;
@@ -313,6 +381,9 @@ namespace detail {
 
    private:
     bool m_initialized;
+    bool m_changeSignalsDeferred;  // registered with m_workspace's open batch
+    unsigned m_batchCheckedDiffs;  // m_diffs already checked against the batch's StrictnessLevel
+    bool m_batchNeedsCheck;        // an edit during the batch needs the full check on commit
     Workspace_Impl* m_workspace;
     OptionalSourceData m_sourceData;
     OptionalTargetData m_targetData;
@@ -322,6 +393,10 @@ namespace detail {
     /** Sets pointer at field index to targetHandle, and returns old target. */
     Handle setPointerImpl(unsigned index, const Handle& targetHandle);
 
+    /** Checks the diffs added since the last call against the open batch's StrictnessLevel, while
+     *  the object is still hot, so that commitBatch only revisits objects that need it. */
+    void checkBatchDiffs();
+
     boost::optional<Handle> convertToTargetHandle(const std::string& name, const std::set<std::string>& referenceLists, bool checkValidity) const;
 
     void restoreOriginalNumFields(unsigned n);
@@ -9,6 +9,7 @@
 #include <utilities/UtilitiesAPI.hpp>
 
 #include <utilities/idf/WorkspaceObject_Impl.hpp>
+#include <utilities/idf/WorkspaceObjectArena.hpp>
 #include <utilities/idf/WorkspaceObjectOrder.hpp>
 #include <utilities/idf/ValidityEnums.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
@@ -25,6 +26,7 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <functional>
 #include <unordered_map>
 
 namespace openstudio {
@@ -154,6 +156,10 @@ namespace detail {
     /// get all idf objects by full idd type
     std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+    /** Calls f with each object of type objectType, in no particular order. f must not add or
+     *  remove objects. */
+    void forEachObjectOfType(IddObjectType objectType, const std::function<void(const std::shared_ptr<WorkspaceObject_Impl>&)>& f) const;
+
     /** Returns the first object found of type objectType and named name (case insensitive,
      *  exact match). */
     boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const;
@@ -175,6 +181,16 @@ namespace detail {
     /** Returns true if fast naming is enabled. */
     bool fastNaming() const;
 
+    /** Returns the arena new object impls are allocated from, or a null pointer if they are
+     *  allocated on the regular heap. */
+    std::shared_ptr<WorkspaceObjectArena> objectArena() const;
+
+    /** Returns true if new objects are allocated from an arena owned by this workspace. */
+    bool useObjectArena() const;
+
+    /** Returns true if new workspaces allocate their objects from an arena. */
+    static bool useObjectArenaByDefault();
+
     //@}
     /** @name Setters */
     //@{
@@ -199,11 +215,13 @@ namespace detail {
     /** Adds objectImplPtrs to the Workspace. As clones, the pointer handles may be incorrect. This
      *  is fixed by applying oldNewHandleMap to the pointer data. If this is a wholeCollectionClone,
      *  then the map is applied to the directOrder (if it exists) as well, otherwise, the new
-     *  objects' handles are pushed onto the directOrder. */
+     *  objects' handles are pushed onto the directOrder. If !indexNamesAndReferences, the objects are
+     *  already in the name and reference indices, see copyNameAndReferenceIndices. */
     virtual std::vector<WorkspaceObject> addClones(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs,
                                                    const HandleMap& oldNewHandleMap, bool collectionClone,
                                                    const std::vector<UHPointer>& pointersIntoWorkspace = UHPointerVector(),
-                                                   const std::vector<HUPointer>& pointersFromWorkspace = HUPointerVector(), bool driverMethod = true);
+                                                   const std::vector<HUPointer>& pointersFromWorkspace = HUPointerVector(), bool driverMethod = true,
+                                                   bool indexNamesAndReferences = true);
 
     /** Add object to Workspace. */
     virtual boost::optional<WorkspaceObject> addObject(const IdfObject& idfObject);
@@ -302,15 +320,43 @@ namespace detail {
      *  targetObject in those reference lists, remove the association. */
     void removeForwardedReferences(const Handle& sourceHandle, unsigned index, const WorkspaceObject& targetObject);
 
+    /** Update the name indices after the name field of the object with handle changed from
+     *  oldName. Called by WorkspaceObject_Impl; does nothing if handle is not in this Workspace. */
+    void updateNameIndex(const Handle& handle, const boost::optional<std::string>& oldName);
+
     /** Setting fast naming to true reduces the time taken to create names by using a UUID as the name.
      *   This UUID is not the same as the object's handle.
      */
     void setFastNaming(bool fastNaming);
 
+    /** Turn arena allocation of new objects on or off. Objects that already exist are not moved. */
+    void setUseObjectArena(bool useObjectArena);
+
+    static void setUseObjectArenaByDefault(bool useObjectArena);
+
     /** Resolve name conflicts within other, and between this workspace and other by renaming objects
      *  in other. */
     bool resolvePotentialNameConflicts(Workspace& other);
 
+    //@}
+    /** @name Batch Editing */
+    //@{
+
+    /** Start a batch of edits, see Workspace::beginBatch. Batches nest. */
+    void beginBatch();
+
+    /** End a batch of edits, see Workspace::commitBatch. Only the outermost commit does any work. */
+    bool commitBatch();
+
+    bool isBatching() const;
+
+    /** Called by WorkspaceObject_Impl, the first time it holds back its change signals during a
+     *  batch. Its (coalesced) signals are emitted on commit. */
+    void deferChangeSignals(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr);
+
+    /** The StrictnessLevel the open batch will be checked at on commit. */
+    StrictnessLevel batchStrictnessLevel() const;
+
     //@}
     /** @name Object Order */
     //@{
@@ -438,6 +484,7 @@ namespace detail {
 
     //public slots:
 
+    /** Emits onChange, or just records that it is due while a batch is open. */
     void change();
 
    protected:
@@ -456,6 +503,7 @@ namespace detail {
     std::string m_header;                                 // header for the IdfFile
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper;  // IDD file to be used for validity checking
     bool m_fastNaming;
+    std::shared_ptr<WorkspaceObjectArena> m_objectArena;  // null unless object arena allocation is on
 
     using WorkspaceObjectMap = std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, boost::hash<boost::uuids::uuid>>;
     WorkspaceObjectMap m_workspaceObjectMap;
@@ -463,14 +511,77 @@ namespace detail {
     // object for ordering objects in the collection.
     WorkspaceObjectOrder m_workspaceObjectOrder;
 
-    // map of IddObjectType to set of objects identified by UUID
-    using IddObjectTypeMap = std::map<IddObjectType, WorkspaceObjectMap>;
+    // objects of each IddObjectType, stored contiguously so that visiting all objects of a type is a
+    // linear walk, and m_iddObjectTypeSlots gives each object's position in its type's vector
+    struct IddObjectTypeHash
+    {
+      std::size_t operator()(const IddObjectType& type) const {
+        return std::hash<int>()(static_cast<int>(type.value()));
+      }
+    };
+    using WorkspaceObjectImplVector = std::vector<std::shared_ptr<WorkspaceObject_Impl>>;
+    using IddObjectTypeMap = std::unordered_map<IddObjectType, WorkspaceObjectImplVector, IddObjectTypeHash>;
     IddObjectTypeMap m_iddObjectTypeMap;
+    using IddObjectTypeSlotMap = std::unordered_map<Handle, std::size_t, boost::hash<boost::uuids::uuid>>;
+    IddObjectTypeSlotMap m_iddObjectTypeSlots;
 
     // map of reference to set of objects identified by UUID
     using IdfReferencesMap = std::unordered_map<std::string, WorkspaceObjectMap>;  // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // reference lists that each target was added to by forwardReferences, so that they can be
+    // re-derived without scanning m_idfReferencesMap
+    using ForwardedReferencesMap = std::unordered_map<Handle, std::set<std::string>, boost::hash<boost::uuids::uuid>>;
+    ForwardedReferencesMap m_forwardedReferences;
+
+    // integer suffixes in use by the objects sharing a base name, for constructing the next name
+    struct SuffixUse
+    {
+      unsigned count = 0;
+      unsigned underscores = 0;  // number of those objects that use "_" rather than " " as spacer
+    };
+    struct NameSuffixes
+    {
+      std::map<int, SuffixUse> uses;
+      int firstUnused = 1;  // smallest positive integer not in uses
+      void insert(int suffix, bool underscore);
+      void erase(int suffix, bool underscore);
+    };
+
+    struct NameSeries
+    {
+      WorkspaceObjectMap objects;
+      NameSuffixes suffixes;
+    };
+
+    // case insensitive indices, keyed on upper-cased names, kept up to date on add, remove and
+    // rename so that name lookups and nextName do not have to scan every object.
+    using NameIndexMap = std::unordered_map<std::string, WorkspaceObjectMap>;
+    NameIndexMap m_nameIndex;
+    using BaseNameIndexMap = std::unordered_map<std::string, NameSeries>;
+    BaseNameIndexMap m_baseNameIndex;
+    using NameSuffixesByTypeMap = std::map<IddObjectType, std::unordered_map<std::string, NameSuffixes>>;
+    NameSuffixesByTypeMap m_nameSuffixesByType;
+
+    // batch editing state. While m_batchDepth > 0 the workspace runs at StrictnessLevel::None,
+    // object change signals and add/remove signals are queued, and forwarded references are only
+    // added; targets that may have lost some are re-derived on commit.
+    struct PendingObjectSignal
+    {
+      bool added;
+      std::shared_ptr<WorkspaceObject_Impl> objectImplPtr;
+      IddObjectType iddObjectType;
+      Handle handle;
+    };
+    unsigned m_batchDepth;
+    StrictnessLevel m_batchStrictnessLevel;
+    bool m_batchStrictnessLevelChanged;  // by setStrictnessLevel during the batch, the whole workspace is checked on commit
+    bool m_batchChanged;
+    bool m_emittingBatchSignals;
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> m_batchChangedObjects;
+    std::vector<PendingObjectSignal> m_batchObjectSignals;
+    std::set<Handle> m_batchReferenceTargets;
+
     // data object for undos
     struct SavedWorkspaceObject
     {
@@ -484,12 +595,17 @@ namespace detail {
 
     // GETTERS
 
+    // Emit or queue the add/remove signals for an object.
+    void emitAddWorkspaceObject(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr);
+    void emitRemoveWorkspaceObject(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr, const Handle& handle);
+
+    // Re-derive the reference lists that targetHandle belongs to from its own IddObject and the
+    // fields that point to it.
+    void rebuildForwardedReferences(const Handle& targetHandle);
+
     // Change over from a HandleSet to a std::vector<Handle>.
     std::vector<Handle> handles(const std::set<Handle>& handles, bool sorted = false) const;
 
-    /** Checks if objectName without any suffix integers matches supplied base name. */
-    bool baseNamesMatch(const std::string& baseName, const std::string& objectName) const;
-
     /** Returns optional suffix integer from objectName. */
     std::tuple<boost::optional<int>, std::string> getNameSuffix(const std::string& objectName) const;
 
@@ -508,10 +624,24 @@ namespace detail {
 
     void insertIntoObjectMap(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    // The IddObjectTypes of m_iddObjectTypeMap, in m_workspaceObjectOrder's order.
+    std::vector<IddObjectType> sortedObjectTypes() const;
+
     void insertIntoIddObjectTypeMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    void removeFromIddObjectTypeMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    void insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void removeFromNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object, const std::string& name);
+
+    // Fills the name and reference indices of a clone of all of other's objects from other's, rather than parsing every
+    // name again. clones maps each object of other to its clone, which must have the same handle.
+    void copyNameAndReferenceIndices(const Workspace_Impl& other,
+                                     const std::unordered_map<const WorkspaceObject_Impl*, std::shared_ptr<WorkspaceObject_Impl>>& clones);
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other, const std::vector<unsigned>& toIgnore);
 
@@ -548,8 +678,9 @@ namespace detail {
 
     // QUERIES
 
-    /** Returns name with the next available integer suffix. */
-    std::string constructNextName(const std::string& objectName, const std::vector<WorkspaceObject>& objectsInTheSeries, bool fillIn) const;
+    /** Returns name with the next available integer suffix. suffixes may be null if no object is
+     *  in the series yet. */
+    std::string constructNextName(const std::string& objectName, const NameSuffixes* suffixes, bool fillIn) const;
 
     std::vector<std::vector<WorkspaceObject>> nameConflicts(const std::vector<WorkspaceObject>& candidates) const;
 
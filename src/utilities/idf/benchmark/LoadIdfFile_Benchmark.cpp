@@ -34,3 +34,24 @@ BENCHMARK_CAPTURE(BM_LoadIdfFile, RefBldgLargeOffice, std::string("energyplus/Re
 BENCHMARK_CAPTURE(BM_LoadIdfFile, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))->Unit(benchmark::kMillisecond);
 
 BENCHMARK_CAPTURE(BM_LoadIdfFile, exampleModel_osm, std::string("model/exampleModel.osm"))->Unit(benchmark::kMillisecond);
+
+static void BM_LoadIdfFileThreads(benchmark::State& state, const std::string& testCase) {
+
+  path idfPath = resourcesPath() / toPath(testCase);
+  auto nThreads = static_cast<unsigned>(state.range(0));
+
+  for (auto _ : state) {
+    OptionalIdfFile oIdfFile = IdfFile::load(idfPath, nullptr, nThreads);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_LoadIdfFileThreads, RefBldgLargeOffice, std::string("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf"))
+  ->RangeMultiplier(2)
+  ->Range(1, 8)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFileThreads, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))
+  ->RangeMultiplier(2)
+  ->Range(1, 8)
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
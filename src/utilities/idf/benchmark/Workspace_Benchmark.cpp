@@ -11,6 +11,7 @@
 #include "../Workspace.hpp"
 #include "../WorkspaceObject.hpp"
 #include "../WorkspaceObject_Impl.hpp"
+#include "../WorkspaceObjectOrder.hpp"
 #include "../ValidityEnums.hpp"
 #include "../../core/Enum.hpp"
 #include "../../core/Optional.hpp"
@@ -18,6 +19,7 @@
 #include "../../idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
+#include <utilities/idd/OS_Space_FieldEnums.hxx>
 
 //#include <iostream>
 
@@ -89,6 +91,143 @@ static void BM_WorkspaceSetNameWithoutAnyChecks(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+static void BM_WorkspaceGetObjectsByName(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+
+  std::vector<std::string> names;
+  for (const auto& obj : w.getObjectsByType(IddObjectType::OS_Space)) {
+    names.push_back(obj.nameString());
+  }
+
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(w.getObjectsByName(names[i++ % names.size()]));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_WorkspaceNextName(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(w.nextName(IddObjectType::OS_Space, true));
+    benchmark::DoNotOptimize(w.nextName("Space 1", false));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Adds 100 named objects to a Workspace that already holds N objects
+static void BM_WorkspaceAddManyNamedObjects(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+
+  std::vector<IdfObject> idfObjects;
+  for (size_t i = 0; i < 100; ++i) {
+    IdfObject idfObject(IddObjectType::OS_Space);
+    idfObject.setName("Added Space " + std::to_string(i + 1));
+    idfObjects.push_back(idfObject);
+  }
+
+  for (auto _ : state) {
+    std::vector<WorkspaceObject> added;
+    for (const auto& idfObject : idfObjects) {
+      added.push_back(w.addObject(idfObject).get());
+    }
+
+    state.PauseTiming();
+    std::vector<Handle> handles;
+    for (const auto& obj : added) {
+      handles.push_back(obj.handle());
+    }
+    w.removeObjects(handles);
+    state.ResumeTiming();
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Clone a workspace of N spaces and edit 1% of the clone, as a parametric driver would
+static void BM_WorkspaceCloneAndEdit(benchmark::State& state) {
+  Workspace w = setUpWorkspaceWithNObjectsOfEveryType(state.range(0));
+  std::vector<WorkspaceObject> spaces = w.getObjectsByType(IddObjectType::OS_Space);
+
+  for (auto _ : state) {
+    Workspace clone = w.clone(true);
+    for (size_t i = 0; i < spaces.size(); i += 100) {
+      clone.getObject(spaces[i].handle())->setName("Edited Space " + std::to_string(i));
+    }
+    benchmark::DoNotOptimize(clone);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Set a field on N spaces, range(1) wraps the edits in a Workspace::BatchEdit
+static void BM_WorkspaceEditManyObjects(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+  std::vector<WorkspaceObject> spaces = w.getObjectsByType(IddObjectType::OS_Space);
+  bool batch = (state.range(1) != 0);
+
+  double value = 0.0;
+  for (auto _ : state) {
+    value += 1.0;
+    if (batch) {
+      Workspace::BatchEdit batchEdit(w);
+      for (auto& space : spaces) {
+        space.setDouble(OS_SpaceFields::XOrigin, value);
+      }
+    } else {
+      for (auto& space : spaces) {
+        space.setDouble(OS_SpaceFields::XOrigin, value);
+      }
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Point N spaces to one of two space types in turn, range(1) wraps the edits in a Workspace::BatchEdit
+static void BM_WorkspaceRepointManyObjects(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+  std::vector<WorkspaceObject> spaces = w.getObjectsByType(IddObjectType::OS_Space);
+  std::vector<WorkspaceObject> spaceTypes{w.addObject(IdfObject(IddObjectType::OS_SpaceType)).get(),
+                                          w.addObject(IdfObject(IddObjectType::OS_SpaceType)).get()};
+  bool batch = (state.range(1) != 0);
+
+  size_t iteration = 0;
+  for (auto _ : state) {
+    const Handle& spaceType = spaceTypes[++iteration % 2].handle();
+    if (batch) {
+      Workspace::BatchEdit batchEdit(w);
+      for (auto& space : spaces) {
+        space.setPointer(OS_SpaceFields::SpaceTypeName, spaceType);
+      }
+    } else {
+      for (auto& space : spaces) {
+        space.setPointer(OS_SpaceFields::SpaceTypeName, spaceType);
+      }
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Sorted objects of a Workspace with 2 objects of every type + N spaces, range(1) orders by IddObjectType rather than by
+// the order the objects were added in
+static void BM_WorkspaceObjectsSorted(benchmark::State& state) {
+  Workspace w = setUpWorkspaceWithNObjectsOfEveryType(state.range(0));
+  if (state.range(1) != 0) {
+    w.order().setOrderByIddEnum();
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(w.objects(true));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -99,3 +238,17 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
 
 BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK(BM_WorkspaceGetObjectsByName)->Unit(benchmark::kMicrosecond)->Arg(1000)->Arg(10000)->Arg(100000)->Complexity();
+
+BENCHMARK(BM_WorkspaceNextName)->Unit(benchmark::kMicrosecond)->Arg(1000)->Arg(10000)->Arg(100000)->Complexity();
+
+BENCHMARK(BM_WorkspaceEditManyObjects)->Unit(benchmark::kMillisecond)->Args({10000, 0})->Args({10000, 1});
+
+BENCHMARK(BM_WorkspaceRepointManyObjects)->Unit(benchmark::kMillisecond)->Args({10000, 0})->Args({10000, 1});
+
+BENCHMARK(BM_WorkspaceCloneAndEdit)->Unit(benchmark::kMillisecond)->Arg(1000)->Arg(10000)->Complexity();
+
+BENCHMARK(BM_WorkspaceObjectsSorted)->Unit(benchmark::kMillisecond)->ArgsProduct({{1000, 10000}, {0, 1}});
+
+BENCHMARK(BM_WorkspaceAddManyNamedObjects)->Unit(benchmark::kMillisecond)->Arg(1000)->Arg(10000)->Arg(100000)->Complexity();
@@ -46,6 +46,11 @@ bool PreparedStatement::bind(int position, double val) {
   return true;
 }
 
+void PreparedStatement::reset() {
+  sqlite3_reset(m_statement);
+  sqlite3_clear_bindings(m_statement);
+}
+
 int PreparedStatement::execute() {
   int code = sqlite3_step(m_statement);
   sqlite3_reset(m_statement);
@@ -60,6 +65,7 @@ boost::optional<double> PreparedStatement::execAndReturnFirstDouble() const {
       value = sqlite3_column_double(m_statement, 0);
     }
   }
+  sqlite3_reset(m_statement);
   return value;
 }
 
@@ -71,6 +77,7 @@ boost::optional<int> PreparedStatement::execAndReturnFirstInt() const {
       value = sqlite3_column_int(m_statement, 0);
     }
   }
+  sqlite3_reset(m_statement);
   return value;
 }
 
@@ -82,6 +89,7 @@ boost::optional<std::string> PreparedStatement::execAndReturnFirstString() const
       value = columnText(sqlite3_column_text(m_statement, 0));
     }
   }
+  sqlite3_reset(m_statement);
   return value;
 }
 
@@ -108,6 +116,7 @@ boost::optional<std::vector<double>> PreparedStatement::execAndReturnVectorOfDou
       }
 
     }  // end loop
+    sqlite3_reset(m_statement);
   }
 
   return valueVector;
@@ -135,6 +144,7 @@ boost::optional<std::vector<int>> PreparedStatement::execAndReturnVectorOfInt()
       }
 
     }  // end loop
+    sqlite3_reset(m_statement);
   }
 
   return valueVector;
@@ -162,6 +172,7 @@ boost::optional<std::vector<std::string>> PreparedStatement::execAndReturnVector
       }
 
     }  // end loop
+    sqlite3_reset(m_statement);
   }
   return valueVector;
 }
@@ -186,4 +197,42 @@ PreparedStatement::PreparedStatement(PreparedStatement::InternalConstructor, con
 int PreparedStatement::get_sqlite3_bind_parameter_count(sqlite3_stmt* statement) {
   return sqlite3_bind_parameter_count(statement);
 }
+
+PreparedStatementCache::PreparedStatementCache(std::size_t capacity) : m_capacity(capacity) {}
+
+std::shared_ptr<PreparedStatement> PreparedStatementCache::get(const std::string& t_stmt, sqlite3* t_db) {
+  auto it = m_index.find(t_stmt);
+  if (it != m_index.end()) {
+    // most recently used goes to the front
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    std::shared_ptr<PreparedStatement> result = it->second->second;
+    result->reset();
+    return result;
+  }
+
+  auto result = std::make_shared<PreparedStatement>(t_stmt, t_db);
+  if (m_capacity == 0) {
+    return result;
+  }
+  if (m_entries.size() >= m_capacity) {
+    m_index.erase(m_entries.back().first);
+    m_entries.pop_back();
+  }
+  m_entries.emplace_front(t_stmt, result);
+  m_index.emplace(t_stmt, m_entries.begin());
+  return result;
+}
+
+void PreparedStatementCache::clear() {
+  m_index.clear();
+  m_entries.clear();
+}
+
+std::size_t PreparedStatementCache::size() const {
+  return m_entries.size();
+}
+
+std::size_t PreparedStatementCache::capacity() const {
+  return m_capacity;
+}
 }  // namespace openstudio
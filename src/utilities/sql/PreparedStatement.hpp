@@ -11,8 +11,11 @@
 
 #include <boost/optional.hpp>
 
+#include <list>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct sqlite3;
@@ -114,6 +117,9 @@ class UTILITIES_API PreparedStatement
   // Executes a **SINGLE** statement
   int execute();
 
+  // Resets the statement so that it can be executed again, and clears its bindings
+  void reset();
+
   [[nodiscard]] boost::optional<double> execAndReturnFirstDouble() const;
 
   [[nodiscard]] boost::optional<int> execAndReturnFirstInt() const;
@@ -134,6 +140,37 @@ class UTILITIES_API PreparedStatement
   [[nodiscard]] boost::optional<std::vector<std::string>> execAndReturnVectorOfString() const;
 };
 
+/** Least recently used cache of the PreparedStatements of one connection, keyed by SQL text. Statements
+ *  stay prepared between calls, so repeated queries skip sqlite3_prepare_v2. The cache must be cleared
+ *  before the connection is closed. */
+class UTILITIES_API PreparedStatementCache
+{
+ public:
+  explicit PreparedStatementCache(std::size_t capacity = 64);
+
+  PreparedStatementCache& operator=(const PreparedStatementCache&) = delete;
+  PreparedStatementCache(const PreparedStatementCache&) = delete;
+
+  // Returns the statement for t_stmt, reset and without bindings, preparing it on first use.
+  // Throws like the PreparedStatement constructor if t_stmt cannot be prepared
+  std::shared_ptr<PreparedStatement> get(const std::string& t_stmt, sqlite3* t_db);
+
+  // Finalizes all cached statements
+  void clear();
+
+  std::size_t size() const;
+
+  std::size_t capacity() const;
+
+ private:
+  using Entry = std::pair<std::string, std::shared_ptr<PreparedStatement>>;
+
+  std::size_t m_capacity;
+  // most recently used first
+  std::list<Entry> m_entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+};
+
 }  // namespace openstudio
 
 #endif  // UTILITIES_SQL_PREPAREDSTATEMENT_HPP
@@ -13,9 +13,9 @@ namespace openstudio {
 
 SqlFile::SqlFile() = default;
 
-SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes) {
+SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes, const bool readOnly) {
   try {
-    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, createIndexes));
+    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, createIndexes, readOnly));
   } catch (const std::exception& e) {
     LOG(Error, "Could not create SqlFile for path '" << openstudio::toString(path) << "' error:" << e.what());
   }
@@ -58,6 +58,14 @@ openstudio::path SqlFile::path() const {
   return result;
 }
 
+bool SqlFile::readOnly() const {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->readOnly();
+  }
+  return result;
+}
+
 bool SqlFile::close() {
   bool result = false;
   if (m_impl) {
@@ -2063,6 +2071,30 @@ void SqlFile::insertTimeSeriesData(const std::string& t_variableType, const std:
                                t_variableUnits, t_timeSeries);
 }
 
+void SqlFile::insertTimeSeriesData(const std::string& t_variableType, const std::string& t_indexGroup, const std::string& t_timestepType,
+                                   const std::string& t_keyValue, const std::string& t_variableName,
+                                   const openstudio::ReportingFrequency& t_reportingFrequency, const boost::optional<std::string>& t_scheduleName,
+                                   const std::string& t_variableUnits, const openstudio::DateTime& t_firstReportDateTime,
+                                   const openstudio::Time& t_intervalLength, const std::vector<double>& t_values) {
+  m_impl->insertTimeSeriesData(t_variableType, t_indexGroup, t_timestepType, t_keyValue, t_variableName, t_reportingFrequency, t_scheduleName,
+                               t_variableUnits, t_firstReportDateTime, t_intervalLength, t_values);
+}
+
+void SqlFile::beginInsertBatch(bool disableJournal) {
+  m_impl->beginInsertBatch(disableJournal);
+}
+
+void SqlFile::commitInsertBatch() {
+  m_impl->commitInsertBatch();
+}
+
+bool SqlFile::isInsertBatchOpen() const {
+  if (m_impl) {
+    return m_impl->isInsertBatchOpen();
+  }
+  return false;
+}
+
 std::vector<std::string> SqlFile::availableReportingFrequencies(const std::string& envPeriod) {
   std::vector<std::string> result;
   if (m_impl) {
@@ -2147,6 +2179,14 @@ TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   return result;
 }
 
+SqlFileTimeSeriesBlock SqlFile::timeSeriesBatch(const std::vector<SqlFileTimeSeriesQuery>& queries) {
+  SqlFileTimeSeriesBlock result;
+  if (m_impl) {
+    result = m_impl->timeSeriesBatch(queries);
+  }
+  return result;
+}
+
 boost::optional<std::pair<DateTime, DateTime>> SqlFile::daylightSavingsPeriod() const {
   boost::optional<std::pair<DateTime, DateTime>> result;
   if (m_impl) {
@@ -2176,6 +2216,23 @@ std::string SqlFile::energyPlusVersion() const {
   return result;
 }
 
+boost::optional<double> SqlFile::componentSizeValue(const std::string& compType, const std::string& compName, const std::string& description,
+                                                   const std::string& units) const {
+  boost::optional<double> result;
+  if (m_impl) {
+    result = m_impl->componentSizeValue(compType, compName, description, units);
+  }
+  return result;
+}
+
+boost::optional<double> SqlFile::componentSizingInformationValue(const std::string& compName, const std::string& description) const {
+  boost::optional<double> result;
+  if (m_impl) {
+    result = m_impl->componentSizingInformationValue(compName, description);
+  }
+  return result;
+}
+
 /// Energy Plus eplusout.sql file name
 std::string SqlFile::energyPlusSqliteFile() const {
   std::string result;
@@ -2495,4 +2552,24 @@ boost::optional<double> SqlFile::assemblyVisibleTransmittance(const std::string&
   return result;
 }
 
+SqlFile::InsertBatch::InsertBatch(SqlFile& sqlFile, bool disableJournal) : m_sqlFile(sqlFile), m_open(false) {
+  m_sqlFile.beginInsertBatch(disableJournal);
+  m_open = true;
+}
+
+SqlFile::InsertBatch::~InsertBatch() {
+  try {
+    commit();
+  } catch (const std::exception& e) {
+    LOG(Error, "Failed to commit insert batch: " << e.what());
+  }
+}
+
+void SqlFile::InsertBatch::commit() {
+  if (m_open) {
+    m_open = false;
+    m_sqlFile.commitInsertBatch();
+  }
+}
+
 }  // namespace openstudio
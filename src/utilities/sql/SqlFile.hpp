@@ -11,6 +11,7 @@
 #include "SummaryData.hpp"
 #include "SqlFileDataDictionary.hpp"
 #include "SqlFileEnums.hpp"
+#include "SqlFileTimeSeriesBlock.hpp"
 #include "SqlFile_Impl.hpp"
 
 #include "../data/Vector.hpp"
@@ -53,7 +54,9 @@ class UTILITIES_API SqlFile
 
   /// constructor from path
   /// Creates indexes by default, pass in false for no new indexes and quicker opening
-  explicit SqlFile(const openstudio::path& path, const bool createIndexes = true);
+  /// Pass in true for readOnly to open the file read-only, with settings tuned for querying
+  /// (memory mapped, large page cache); indexes are never created in that mode
+  explicit SqlFile(const openstudio::path& path, const bool createIndexes = true, const bool readOnly = false);
 
   /// initializes a new sql file for output
   /// Creates indexes by default, pass in false for no indexes and quicker creation
@@ -100,6 +103,9 @@ class UTILITIES_API SqlFile
   // return an Assembly Visible Transmittance value for matching subSurfaceName (RowName)
   boost::optional<double> assemblyVisibleTransmittance(const std::string& subSurfaceName) const;
 
+  /// returns true if the file was opened read-only
+  bool readOnly() const;
+
   /// close the file
   bool close();
 
@@ -1085,6 +1091,17 @@ class UTILITIES_API SqlFile
   /// Energy plus version number
   std::string energyPlusVersion() const;
 
+  /** Returns the Value of the ComponentSizes row matching compType, compName (upper case),
+   *  description, and units. The table is loaded into an in-memory index on first use, so repeated
+   *  lookups do not query the file. */
+  boost::optional<double> componentSizeValue(const std::string& compType, const std::string& compName, const std::string& description,
+                                             const std::string& units) const;
+
+  /** Returns the 'Value' column of the first row of the InitializationSummary Component Sizing
+   *  Information table that contains both compName (upper case) and description, which is usually of
+   *  the form "Name [units]". The table is loaded into an in-memory index on first use. */
+  boost::optional<double> componentSizingInformationValue(const std::string& compName, const std::string& description) const;
+
   //@}
   /** @name Generic TimeSeries Interface */
   //@{
@@ -1135,6 +1152,12 @@ class UTILITIES_API SqlFile
    *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
   std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+  /** Executes all queries at once, reading the report data of each environment period in a single
+   *  pass. Queries are expanded as needed, and each matching time series becomes one column of the
+   *  returned block. Series reported at the same times share one time axis, which is cached on this
+   *  SqlFile. */
+  SqlFileTimeSeriesBlock timeSeriesBatch(const std::vector<SqlFileTimeSeriesQuery>& queries);
+
   //@}
   /** @name Illuminance Map Interface */
   //@{
@@ -1342,6 +1365,36 @@ class UTILITIES_API SqlFile
                             const openstudio::ReportingFrequency& t_reportingFrequency, const boost::optional<std::string>& t_scheduleName,
                             const std::string& t_variableUnits, const openstudio::TimeSeries& t_timeSeries);
 
+  /** Insert regular interval data, t_values[i] is reported at t_firstReportDateTime + i * t_intervalLength. Same as the
+   *  TimeSeries overload, without building a TimeSeries. */
+  void insertTimeSeriesData(const std::string& t_variableType, const std::string& t_indexGroup, const std::string& t_timestepType,
+                            const std::string& t_keyValue, const std::string& t_variableName,
+                            const openstudio::ReportingFrequency& t_reportingFrequency, const boost::optional<std::string>& t_scheduleName,
+                            const std::string& t_variableUnits, const openstudio::DateTime& t_firstReportDateTime,
+                            const openstudio::Time& t_intervalLength, const std::vector<double>& t_values);
+
+  //@}
+  /** @name Insert Batches */
+  //@{
+
+  class InsertBatch;
+
+  /** Start a batch of inserts. Until the matching commitInsertBatch, all the insert* methods write into a single
+   *  transaction instead of committing each call, and the Time table lookups done by insertTimeSeriesData are cached.
+   *  If disableJournal is true, the rollback journal and synchronous writes are turned off for the duration of the batch:
+   *  this is much faster, but the file is likely to be corrupted if the process dies before the commit, so only use it
+   *  for scratch files.
+   *
+   *  Batches nest, only the outermost beginInsertBatch and commitInsertBatch take effect. Prefer InsertBatch, which
+   *  cannot be left open. */
+  void beginInsertBatch(bool disableJournal = false);
+
+  /** Commit the batch started by beginInsertBatch, and restore the journal settings. */
+  void commitInsertBatch();
+
+  /** Returns true if a batch of inserts is open. */
+  bool isInsertBatchOpen() const;
+
   //@}
   /** @name Operators */
   //@{
@@ -1363,6 +1416,35 @@ class UTILITIES_API SqlFile
   detail::DataDictionaryTable dataDictionary() const;
 };
 
+/** Scope for a batch of inserts into a SqlFile, see SqlFile::beginInsertBatch. The batch is committed by commit, or on
+ *  destruction if commit was not called.
+ *
+ *  \code
+ *  {
+ *    SqlFile::InsertBatch batch(sqlFile, true);
+ *    for (const TimeSeries& timeSeries : timeSeriesToWrite) {
+ *      sqlFile.insertTimeSeriesData("Sum", "Zone", "Zone", keyValue, name, ReportingFrequency::Hourly, boost::none, units, timeSeries);
+ *    }
+ *  }
+ *  \endcode */
+class UTILITIES_API SqlFile::InsertBatch
+{
+ public:
+  explicit InsertBatch(SqlFile& sqlFile, bool disableJournal = false);
+
+  ~InsertBatch();
+
+  InsertBatch(const InsertBatch& other) = delete;
+  InsertBatch& operator=(const InsertBatch& other) = delete;
+
+  /** Commit the batch. Does nothing if already committed. */
+  void commit();
+
+ private:
+  SqlFile m_sqlFile;
+  bool m_open;
+};
+
 /// optional SqlFile
 using OptionalSqlFile = boost::optional<SqlFile>;
 
@@ -8,6 +8,7 @@
   #include <utilities/sql/SqlFile.hpp>
   #include <utilities/sql/SqlFileEnums.hpp>
   #include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
+  #include <utilities/sql/SqlFileTimeSeriesBlock.hpp>
   #include <utilities/sql/SummaryData.hpp>
 
   #include <utilities/units/Unit.hpp>
@@ -31,6 +32,10 @@
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(const std::string&, double&, double&) const;
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(int, double&, double&) const;
 
+// Raw pointer into the block's storage, use values() instead
+%ignore openstudio::SqlFileTimeSeriesBlock::data;
+%ignore openstudio::SqlFile::InsertBatch;
+
 // create an instantiation of the optional classes
 %template(OptionalSqlFile) boost::optional<openstudio::SqlFile>;
 %template(OptionalEnvironmentType) boost::optional<openstudio::EnvironmentType>;
@@ -53,6 +58,7 @@
 %include <utilities/sql/SummaryData.hpp>
 %include <utilities/sql/SqlFile.hpp>
 %include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
+%include <utilities/sql/SqlFileTimeSeriesBlock.hpp>
 %include <utilities/sql/SqlFileEnums.hpp>
 
 #endif //UTILITIES_OUTPUT_SQLFILE_I
@@ -0,0 +1,107 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "SqlFileTimeSeriesBlock.hpp"
+
+#include "../data/Vector.hpp"
+
+#include <stdexcept>
+
+namespace openstudio {
+
+SqlFileTimeSeriesBlock::SqlFileTimeSeriesBlock() = default;
+
+unsigned SqlFileTimeSeriesBlock::numColumns() const {
+  return m_columns.size();
+}
+
+bool SqlFileTimeSeriesBlock::empty() const {
+  return m_columns.empty();
+}
+
+std::string SqlFileTimeSeriesBlock::environmentPeriod(unsigned column) const {
+  return this->column(column).envPeriod;
+}
+
+std::string SqlFileTimeSeriesBlock::reportingFrequency(unsigned column) const {
+  return this->column(column).reportingFrequency;
+}
+
+std::string SqlFileTimeSeriesBlock::timeSeriesName(unsigned column) const {
+  return this->column(column).timeSeriesName;
+}
+
+std::string SqlFileTimeSeriesBlock::keyValue(unsigned column) const {
+  return this->column(column).keyValue;
+}
+
+std::string SqlFileTimeSeriesBlock::units(unsigned column) const {
+  return this->column(column).units;
+}
+
+boost::optional<unsigned> SqlFileTimeSeriesBlock::findColumn(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                             const std::string& timeSeriesName, const std::string& keyValue) const {
+  for (unsigned i = 0, n = m_columns.size(); i < n; ++i) {
+    const Column& c = m_columns[i];
+    if ((c.timeSeriesName == timeSeriesName) && (c.keyValue == keyValue) && (c.reportingFrequency == reportingFrequency)
+        && (c.envPeriod == envPeriod)) {
+      return i;
+    }
+  }
+  return boost::none;
+}
+
+unsigned SqlFileTimeSeriesBlock::size(unsigned column) const {
+  return this->column(column).size;
+}
+
+const double* SqlFileTimeSeriesBlock::data(unsigned column) const {
+  return m_values.data() + this->column(column).offset;
+}
+
+std::vector<double> SqlFileTimeSeriesBlock::values(unsigned column) const {
+  const Column& c = this->column(column);
+  return {m_values.begin() + c.offset, m_values.begin() + c.offset + c.size};
+}
+
+DateTime SqlFileTimeSeriesBlock::firstReportDateTime(unsigned column) const {
+  return this->column(column).timeAxis->firstReportDateTime;
+}
+
+std::vector<long> SqlFileTimeSeriesBlock::secondsFromFirstReport(unsigned column) const {
+  return this->column(column).timeAxis->secondsFromFirstReport;
+}
+
+boost::optional<Time> SqlFileTimeSeriesBlock::intervalLength(unsigned column) const {
+  const detail::SqlFileTimeAxis& timeAxis = *this->column(column).timeAxis;
+  if (timeAxis.intervalMinutes) {
+    return Time(0, 0, *timeAxis.intervalMinutes, 0);
+  }
+  return boost::none;
+}
+
+bool SqlFileTimeSeriesBlock::sharesTimeAxis(unsigned column, unsigned otherColumn) const {
+  return this->column(column).timeAxis == this->column(otherColumn).timeAxis;
+}
+
+TimeSeries SqlFileTimeSeriesBlock::timeSeries(unsigned column) const {
+  const Column& c = this->column(column);
+  Vector values(c.size);
+  std::copy(m_values.begin() + c.offset, m_values.begin() + c.offset + c.size, values.begin());
+  if (c.timeAxis->intervalMinutes) {
+    return {c.timeAxis->firstReportDateTime, Time(0, 0, *c.timeAxis->intervalMinutes, 0), values, c.units};
+  }
+  return {c.timeAxis->firstReportDateTime, c.timeAxis->secondsFromFirstReport, values, c.units};
+}
+
+const SqlFileTimeSeriesBlock::Column& SqlFileTimeSeriesBlock::column(unsigned column) const {
+  if (column >= m_columns.size()) {
+    throw std::out_of_range("SqlFileTimeSeriesBlock column " + std::to_string(column) + " is out of range, block has "
+                            + std::to_string(m_columns.size()) + " columns.");
+  }
+  return m_columns[column];
+}
+
+}  // namespace openstudio
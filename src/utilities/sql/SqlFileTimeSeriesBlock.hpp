@@ -0,0 +1,125 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILETIMESERIESBLOCK_HPP
+#define UTILITIES_SQL_SQLFILETIMESERIESBLOCK_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../data/TimeSeries.hpp"
+#include "../time/DateTime.hpp"
+#include "../time/Time.hpp"
+
+#include <boost/optional.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+// forward declarations
+namespace detail {
+  class SqlFile_Impl;
+
+  /// time axis shared by all the time series reported for one environment period at one reporting frequency
+  struct UTILITIES_API SqlFileTimeAxis
+  {
+    /// TimeIndex of each report in the Time table
+    std::vector<int> timeIndices;
+    openstudio::DateTime firstReportDateTime;
+    std::vector<long> secondsFromFirstReport;
+    /// set if all reports are evenly spaced
+    boost::optional<unsigned> intervalMinutes;
+  };
+}  // namespace detail
+
+/** Columnar result of SqlFile::timeSeriesBatch. Each column holds one time series; the values of
+ *  all columns live in a single buffer, and columns reported for the same environment period at the
+ *  same reporting frequency share one time axis. */
+class UTILITIES_API SqlFileTimeSeriesBlock
+{
+ public:
+  /** @name Constructors */
+  //@{
+
+  /** Constructs an empty block. */
+  SqlFileTimeSeriesBlock();
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  /** Number of time series in the block. */
+  unsigned numColumns() const;
+
+  bool empty() const;
+
+  /** Environment period of column, upper-cased as in the SqlFile data dictionary. */
+  std::string environmentPeriod(unsigned column) const;
+
+  /** Reporting frequency of column, as stored in the SqlFile. */
+  std::string reportingFrequency(unsigned column) const;
+
+  /** Time series (variable or meter) name of column. */
+  std::string timeSeriesName(unsigned column) const;
+
+  std::string keyValue(unsigned column) const;
+
+  std::string units(unsigned column) const;
+
+  /** Returns the index of the column for the given time series, if it is in the block. */
+  boost::optional<unsigned> findColumn(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName,
+                                       const std::string& keyValue) const;
+
+  /** Number of values in column. */
+  unsigned size(unsigned column) const;
+
+  /** Pointer to the size(column) contiguous values of column. */
+  const double* data(unsigned column) const;
+
+  /** Copy of the values of column. */
+  std::vector<double> values(unsigned column) const;
+
+  DateTime firstReportDateTime(unsigned column) const;
+
+  /** Seconds from the first report, for each value of column. */
+  std::vector<long> secondsFromFirstReport(unsigned column) const;
+
+  /** Interval between reports, if they are evenly spaced (Timestep, Hourly, and Daily data). */
+  boost::optional<Time> intervalLength(unsigned column) const;
+
+  /** Returns true if both columns use the same time axis object. */
+  bool sharesTimeAxis(unsigned column, unsigned otherColumn) const;
+
+  /** Returns column as a TimeSeries, equal to what SqlFile::timeSeries returns for it. */
+  TimeSeries timeSeries(unsigned column) const;
+
+  //@}
+
+ private:
+  friend class detail::SqlFile_Impl;
+
+  struct Column
+  {
+    std::string envPeriod;
+    std::string reportingFrequency;
+    std::string timeSeriesName;
+    std::string keyValue;
+    std::string units;
+    std::size_t offset;
+    std::size_t size;
+    std::shared_ptr<const detail::SqlFileTimeAxis> timeAxis;
+  };
+
+  const Column& column(unsigned column) const;
+
+  std::vector<double> m_values;
+  std::vector<Column> m_columns;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_SQL_SQLFILETIMESERIESBLOCK_HPP
@@ -18,6 +18,8 @@
 
 #include <sqlite3.h>
 
+#include <boost/functional/hash.hpp>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -37,9 +39,10 @@ namespace detail {
     return {reinterpret_cast<const char*>(column)};
   }
 
-  SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
+  SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes, const bool readOnly)
     : m_path(path),
       m_connectionOpen(false),
+      m_readOnly(readOnly),
       m_supportedVersion(false),
       m_hasYear(true),
       m_hasIlluminanceMapYear(true),
@@ -55,7 +58,7 @@ namespace detail {
 
   SqlFile_Impl::SqlFile_Impl(const openstudio::path& t_path, const openstudio::EpwFile& t_epwFile, const openstudio::DateTime& t_simulationTime,
                              const openstudio::Calendar& t_calendar, const bool createIndexes)
-    : m_path(t_path) {
+    : m_path(t_path), m_readOnly(false) {
     if (openstudio::filesystem::exists(m_path)) {
       m_path = openstudio::filesystem::canonical(m_path);
     }
@@ -230,7 +233,7 @@ namespace detail {
   }
 
   void SqlFile_Impl::removeIndexes() {
-    if (m_connectionOpen) {
+    if (m_connectionOpen && isWritable()) {
       try {
         execAndThrowOnError("DROP INDEX IF EXISTS rddMTR;");
       } catch (const std::runtime_error& e) {
@@ -270,7 +273,7 @@ namespace detail {
   }
 
   void SqlFile_Impl::createIndexes() {
-    if (m_connectionOpen) {
+    if (m_connectionOpen && isWritable()) {
       try {
         execAndThrowOnError("CREATE INDEX IF NOT EXISTS rddMTR ON ReportDataDictionary (IsMeter);");
       } catch (const std::runtime_error& e) {
@@ -364,13 +367,14 @@ namespace detail {
       stmt = std::make_shared<PreparedStatement>(
         "insert into time (TimeIndex, Year, Month, Day, Hour, Minute, Dst, Interval, IntervalType, SimulationDays, DayType, EnvironmentPeriodIndex, "
         "WarmupFlag) values (?, ?, ?, ?, ?, 0, 0, 60, 1, ?, ?, ?, null)",
-        m_db, true);
+        m_db, !isInsertBatchOpen());
     } else {
       stmt =
         std::make_shared<PreparedStatement>("insert into time (TimeIndex, Month, Day, Hour, Minute, Dst, Interval, IntervalType, SimulationDays, "
                                             "DayType, EnvironmentPeriodIndex, WarmupFlag) values (?, ?, ?, ?, 0, 0, 60, 1, ?, ?, ?, null)",
-                                            m_db, true);
+                                            m_db, !isInsertBatchOpen());
     }
+    m_timeIndexByReportTime.reset();
 
     int simulationDay = 1;
     for (openstudio::Date d = t_calendar.startDate(); d <= t_calendar.endDate(); d += openstudio::Time(1, 0)) {
@@ -423,11 +427,27 @@ namespace detail {
     return m_path;
   }
 
+  bool SqlFile_Impl::readOnly() const {
+    return m_readOnly;
+  }
+
+  bool SqlFile_Impl::isWritable() const {
+    return !m_readOnly && (sqlite3_db_readonly(m_db, "main") == 0);
+  }
+
   bool SqlFile_Impl::close() {
     if (m_connectionOpen) {
+      if (m_insertBatchDepth > 0) {
+        LOG(Warn, "Committing open insert batch on close of SqlFile '" << toString(m_path) << "'");
+        m_insertBatchDepth = 1;
+        commitInsertBatch();
+      }
+      m_statementCache.clear();
       sqlite3_close(m_db);
       m_connectionOpen = false;
     }
+    m_componentSizes.reset();
+    m_componentSizingInformation.reset();
     return true;
   }
 
@@ -447,11 +467,17 @@ namespace detail {
     m_sqliteFilename = toString(m_path.make_preferred().native());
     std::string fileName = m_sqliteFilename;
 
-    int code = sqlite3_open_v2(fileName.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE, nullptr);
+    int flags = m_readOnly ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE);
+    int code = sqlite3_open_v2(fileName.c_str(), &m_db, flags, nullptr);
 
     m_connectionOpen = (code == 0);
     if (m_connectionOpen) {  // create index on dictionaryIndex for large table reportvariabledata
+      if (m_readOnly) {
+        // map the file and keep most of it in the page cache, nothing is ever written back
+        sqlite3_exec(m_db, "PRAGMA query_only = ON; PRAGMA mmap_size = 268435456; PRAGMA cache_size = -65536;", nullptr, nullptr, nullptr);
+      }
       if (!isValidConnection()) {
+        m_statementCache.clear();
         sqlite3_close(m_db);
         m_connectionOpen = false;
         throw openstudio::Exception("OpenStudio is not compatible with this file.");
@@ -610,10 +636,12 @@ namespace detail {
     std::shared_ptr<PreparedStatement> stmt1;
     if (hasIlluminanceMapYear()) {
       stmt1 = std::make_shared<PreparedStatement>(
-        "insert into daylightmaphourlyreports (HourlyReportIndex, MapNumber, Year, Month, DayOfMonth, Hour) values (?, ?, ?, ?, ?, ?)", m_db, true);
+        "insert into daylightmaphourlyreports (HourlyReportIndex, MapNumber, Year, Month, DayOfMonth, Hour) values (?, ?, ?, ?, ?, ?)", m_db,
+        !isInsertBatchOpen());
     } else {
       stmt1 = std::make_shared<PreparedStatement>(
-        "insert into daylightmaphourlyreports (HourlyReportIndex, MapNumber, Month, DayOfMonth, Hour) values (?, ?, ?, ?, ?)", m_db, true);
+        "insert into daylightmaphourlyreports (HourlyReportIndex, MapNumber, Month, DayOfMonth, Hour) values (?, ?, ?, ?, ?)", m_db,
+        !isInsertBatchOpen());
     }
 
     for (size_t dateidx = 0; dateidx < t_times.size(); ++dateidx) {
@@ -677,6 +705,47 @@ namespace detail {
                                           const openstudio::ReportingFrequency& t_reportingFrequency,
                                           const boost::optional<std::string>& t_scheduleName, const std::string& t_variableUnits,
                                           const openstudio::TimeSeries& t_timeSeries) {
+    int datadicindex = insertReportDataDictionary(t_variableType, t_indexGroup, t_timestepType, t_keyValue, t_variableName, t_reportingFrequency,
+                                                  t_scheduleName, t_variableUnits);
+
+    std::vector<double> values = toStandardVector(t_timeSeries.values());
+    std::vector<double> days = toStandardVector(t_timeSeries.daysFromFirstReport());
+
+    openstudio::DateTime firstdate = t_timeSeries.firstReportDateTime();
+
+    std::vector<openstudio::DateTime> dateTimes;
+    dateTimes.reserve(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      dateTimes.push_back(firstdate + openstudio::Time(days[i]));
+    }
+
+    insertReportData(datadicindex, dateTimes, values);
+  }
+
+  void SqlFile_Impl::insertTimeSeriesData(const std::string& t_variableType, const std::string& t_indexGroup, const std::string& t_timestepType,
+                                          const std::string& t_keyValue, const std::string& t_variableName,
+                                          const openstudio::ReportingFrequency& t_reportingFrequency,
+                                          const boost::optional<std::string>& t_scheduleName, const std::string& t_variableUnits,
+                                          const openstudio::DateTime& t_firstReportDateTime, const openstudio::Time& t_intervalLength,
+                                          const std::vector<double>& t_values) {
+    int datadicindex = insertReportDataDictionary(t_variableType, t_indexGroup, t_timestepType, t_keyValue, t_variableName, t_reportingFrequency,
+                                                  t_scheduleName, t_variableUnits);
+
+    std::vector<openstudio::DateTime> dateTimes;
+    dateTimes.reserve(t_values.size());
+    openstudio::DateTime dt = t_firstReportDateTime;
+    for (size_t i = 0; i < t_values.size(); ++i) {
+      dateTimes.push_back(dt);
+      dt += t_intervalLength;
+    }
+
+    insertReportData(datadicindex, dateTimes, t_values);
+  }
+
+  int SqlFile_Impl::insertReportDataDictionary(const std::string& t_variableType, const std::string& t_indexGroup, const std::string& t_timestepType,
+                                               const std::string& t_keyValue, const std::string& t_variableName,
+                                               const openstudio::ReportingFrequency& t_reportingFrequency,
+                                               const boost::optional<std::string>& t_scheduleName, const std::string& t_variableUnits) {
     int datadicindex = getNextIndex("reportdatadictionary", "ReportDataDictionaryIndex");
 
     std::stringstream insertReportDataDictionary;
@@ -696,27 +765,34 @@ namespace detail {
 
     execAndThrowOnError(insertReportDataDictionary.str());
 
-    std::vector<double> values = toStandardVector(t_timeSeries.values());
-    std::vector<double> days = toStandardVector(t_timeSeries.daysFromFirstReport());
+    return datadicindex;
+  }
 
-    openstudio::DateTime firstdate = t_timeSeries.firstReportDateTime();
+  void SqlFile_Impl::insertReportData(int t_dataDictionaryIndex, const std::vector<openstudio::DateTime>& t_dateTimes,
+                                      const std::vector<double>& t_values) {
+    OS_ASSERT(t_dateTimes.size() == t_values.size());
 
-    std::shared_ptr<PreparedStatement> stmt;
-    if (hasYear()) {
-      // we'll let stmt1 have the transaction
-      stmt =
-        std::make_shared<PreparedStatement>("insert into reportdata (ReportDataIndex, TimeIndex, ReportDataDictionaryIndex, Value) values ( ?, "
-                                            "(select TimeIndex from time where Year=? and Month=? and Day=? and Hour=? and Minute=? limit 1), ?, ?);",
-                                            m_db, true);
+    // outside of a batch, the Time table is read once per call instead of once per row
+    std::unordered_map<std::int64_t, int> timeIndexes;
+    const std::unordered_map<std::int64_t, int>* timeIndexByReportTime = nullptr;
+    if (isInsertBatchOpen()) {
+      timeIndexByReportTime = &this->timeIndexByReportTime();
     } else {
-      stmt = std::make_shared<PreparedStatement>("insert into reportdata (ReportDataIndex, TimeIndex, ReportDataDictionaryIndex, Value) values ( ?, "
-                                                 "(select TimeIndex from time where Month=? and Day=? and Hour=? and Minute=? limit 1), ?, ?);",
-                                                 m_db, true);
+      this->timeIndexByReportTime();
+      timeIndexes = std::move(*m_timeIndexByReportTime);
+      m_timeIndexByReportTime.reset();
+      timeIndexByReportTime = &timeIndexes;
     }
 
-    for (size_t i = 0; i < values.size(); ++i) {
-      openstudio::DateTime dt = firstdate + openstudio::Time(days[i]);
-      double value = values[i];
+    // the rows of this call are the only ones written until it returns
+    int reportdataindex = getNextIndex("reportdata", "ReportDataIndex");
+
+    // inside a batch, the batch has the transaction
+    PreparedStatement stmt("insert into reportdata (ReportDataIndex, TimeIndex, ReportDataDictionaryIndex, Value) values (?, ?, ?, ?);", m_db,
+                           !isInsertBatchOpen());
+
+    for (size_t i = 0; i < t_values.size(); ++i) {
+      openstudio::DateTime dt = t_dateTimes[i];
 
       if (dt.time().seconds() == 59) {
         // rounding error, let's help
@@ -736,23 +812,108 @@ namespace detail {
 
       ++hour;  // energyplus says time goes from 1-24 not from 0-23
 
-      int reportdataindex = getNextIndex("reportdata", "ReportDataIndex");
-      int b = 0;
-      stmt->bind(++b, reportdataindex);
-      if (hasYear()) {
-        stmt->bind(++b, year);
+      // clear the bindings of the previous row, TimeIndex stays null if there is no such time
+      stmt.reset();
+      stmt.bind(1, reportdataindex++);
+      auto it = timeIndexByReportTime->find(reportTimeKey(year, month, day, hour, minute));
+      if (it != timeIndexByReportTime->end()) {
+        stmt.bind(2, it->second);
       }
-      stmt->bind(++b, month);
-      stmt->bind(++b, day);
-      stmt->bind(++b, hour);
-      stmt->bind(++b, minute);
-      stmt->bind(++b, datadicindex);
-      stmt->bind(++b, value);
+      stmt.bind(3, t_dataDictionaryIndex);
+      stmt.bind(4, t_values[i]);
 
-      stmt->execAndThrowOnError();
+      stmt.execAndThrowOnError();
     }
   }
 
+  const std::unordered_map<std::int64_t, int>& SqlFile_Impl::timeIndexByReportTime() {
+    if (!m_timeIndexByReportTime) {
+      m_timeIndexByReportTime = std::unordered_map<std::int64_t, int>();
+
+      std::string query = hasYear() ? "SELECT TimeIndex, Year, Month, Day, Hour, Minute FROM Time ORDER BY rowid;"
+                                    : "SELECT TimeIndex, 0, Month, Day, Hour, Minute FROM Time ORDER BY rowid;";
+
+      sqlite3_stmt* sqlStmtPtr;
+      sqlite3_prepare_v2(m_db, query.c_str(), -1, &sqlStmtPtr, nullptr);
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        bool hasNull = false;
+        for (int i = 0; i < 6; ++i) {
+          hasNull = hasNull || (sqlite3_column_type(sqlStmtPtr, i) == SQLITE_NULL);
+        }
+        if (hasNull) {
+          // would not match in "where Year=? and Month=? and Day=? and Hour=? and Minute=?"
+          continue;
+        }
+        std::int64_t key = reportTimeKey(sqlite3_column_int(sqlStmtPtr, 1), sqlite3_column_int(sqlStmtPtr, 2), sqlite3_column_int(sqlStmtPtr, 3),
+                                         sqlite3_column_int(sqlStmtPtr, 4), sqlite3_column_int(sqlStmtPtr, 5));
+        // keep the first matching row, as "limit 1" did
+        m_timeIndexByReportTime->emplace(key, sqlite3_column_int(sqlStmtPtr, 0));
+      }
+      sqlite3_finalize(sqlStmtPtr);
+    }
+    return *m_timeIndexByReportTime;
+  }
+
+  std::int64_t SqlFile_Impl::reportTimeKey(int year, int month, int day, int hour, int minute) const {
+    if (!hasYear()) {
+      year = 0;
+    }
+    // month, day, hour and minute all fit in 8 bits
+    return (static_cast<std::int64_t>(year) << 32) | (static_cast<std::int64_t>(month & 0xFF) << 24) | ((day & 0xFF) << 16) | ((hour & 0xFF) << 8)
+           | (minute & 0xFF);
+  }
+
+  void SqlFile_Impl::beginInsertBatch(bool disableJournal) {
+    if (m_insertBatchDepth == 0) {
+      if (!isWritable()) {
+        LOG_AND_THROW("Cannot insert into read only SqlFile '" << toString(m_path) << "'");
+      }
+
+      // most of the time goes into updating the ReportData indexes, which is much faster if their pages stay in the cache
+      m_restorePragmasAfterInsertBatch.clear();
+      if (boost::optional<int> cacheSize = execAndReturnFirstInt("PRAGMA cache_size;")) {
+        m_restorePragmasAfterInsertBatch.push_back("PRAGMA cache_size = " + std::to_string(*cacheSize) + ";");
+        execAndThrowOnError("PRAGMA cache_size = -65536;");
+      }
+
+      if (disableJournal) {
+        // journal mode cannot be changed inside of a transaction
+        boost::optional<std::string> journalMode = execAndReturnFirstString("PRAGMA journal_mode;");
+        boost::optional<int> synchronous = execAndReturnFirstInt("PRAGMA synchronous;");
+        m_restorePragmasAfterInsertBatch.push_back("PRAGMA journal_mode = " + journalMode.value_or("delete") + ";");
+        m_restorePragmasAfterInsertBatch.push_back("PRAGMA synchronous = " + std::to_string(synchronous.value_or(2)) + ";");
+        execAndThrowOnError("PRAGMA journal_mode = OFF;");
+        execAndThrowOnError("PRAGMA synchronous = OFF;");
+      }
+
+      execAndThrowOnError("BEGIN TRANSACTION;");
+      m_timeIndexByReportTime.reset();
+    }
+    ++m_insertBatchDepth;
+  }
+
+  void SqlFile_Impl::commitInsertBatch() {
+    if (m_insertBatchDepth == 0) {
+      LOG(Warn, "No insert batch to commit");
+      return;
+    }
+
+    --m_insertBatchDepth;
+    if (m_insertBatchDepth == 0) {
+      m_timeIndexByReportTime.reset();
+      execAndThrowOnError("COMMIT;");
+
+      for (const std::string& pragma : m_restorePragmasAfterInsertBatch) {
+        execAndThrowOnError(pragma);
+      }
+      m_restorePragmasAfterInsertBatch.clear();
+    }
+  }
+
+  bool SqlFile_Impl::isInsertBatchOpen() const {
+    return m_insertBatchDepth > 0;
+  }
+
   std::vector<SummaryData> SqlFile_Impl::getSummaryData() const {
     std::vector<SummaryData> retval;
 
@@ -2982,30 +3143,8 @@ namespace detail {
 
   openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary) {
     openstudio::OptionalTimeSeries ts;
-    std::string units = dataDictionary.units;
-
-    boost::optional<openstudio::DateTime> firstReportDateTime;
-    std::vector<long> stdSecondsFromFirstReport;
-    stdSecondsFromFirstReport.reserve(8760);
-
-    std::vector<double> stdValues;
-    stdValues.reserve(8760);
-    boost::optional<unsigned> reportingIntervalMinutes;
-
-    ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
-    bool isIntervalTimeSeries = false;
-    try {
-      reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
-      isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) || (reportingFrequency == ReportingFrequency::Hourly)
-                             || (reportingFrequency == ReportingFrequency::Daily);
-
-    } catch (const std::exception&) {
-    }
 
     if (m_db) {
-      std::string energyPlusVersion = this->energyPlusVersion();
-      VersionString version(energyPlusVersion);
-
       std::stringstream s;
       // v8.9.0 added the 'Year' field
       s << "SELECT dt.VariableValue, ";
@@ -3039,115 +3178,159 @@ namespace detail {
       s2 << code;
       LOG(Debug, s2.str());
 
-      long cumulativeSeconds = 0;
+      std::vector<double> stdValues;
+      stdValues.reserve(8760);
+      std::vector<TimeRow> timeRows;
+      timeRows.reserve(8760);
 
       while (code == SQLITE_ROW) {
         int b = 0;
-        double value = sqlite3_column_double(sqlStmtPtr, b++);
-        stdValues.push_back(value);
+        stdValues.push_back(sqlite3_column_double(sqlStmtPtr, b++));
 
-        boost::optional<unsigned> year;
+        TimeRow timeRow;
         if (hasYear()) {
-          year = sqlite3_column_int(sqlStmtPtr, b++);
-          // As of EnergyPlus 9.4 and perhaps earlier, the anual run periods will have a valid year,
-          // however the sizing periods will have year = 0
-          if (year.get() == 0) {
-            year.reset();
-          }
+          timeRow.year = sqlite3_column_int(sqlStmtPtr, b++);
         }
+        timeRow.month = sqlite3_column_int(sqlStmtPtr, b++);
+        timeRow.day = sqlite3_column_int(sqlStmtPtr, b++);
+        timeRow.intervalMinutes = sqlite3_column_int(sqlStmtPtr, b++);
+        timeRows.push_back(timeRow);
 
-        unsigned month = sqlite3_column_int(sqlStmtPtr, b++);
-        unsigned day = sqlite3_column_int(sqlStmtPtr, b++);
-
-        // In cases where you report the same meter key for eg at Daily and at Timestep frequency
-        // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
-        // And since we can compute this easily, might as well do it
-        unsigned intervalMinutes;
-        if (reportingFrequency == ReportingFrequency::Hourly) {
-          intervalMinutes = 60;
-        } else if (reportingFrequency == ReportingFrequency::Daily) {
-          intervalMinutes = 24 * 60;
-        } else if (reportingFrequency == ReportingFrequency::Monthly) {
-          intervalMinutes = day * 24 * 60;
+        // step to next row
+        code = sqlite3_step(sqlStmtPtr);
+      }
+
+      // must finalize to prevent memory leaks
+      sqlite3_finalize(sqlStmtPtr);
+
+      std::shared_ptr<SqlFileTimeAxis> timeAxis = makeTimeAxis(dataDictionary.reportingFrequency, dataDictionary.envPeriodIndex, timeRows);
+      if (timeAxis) {
+        openstudio::Vector values = createVector(stdValues);
+        if (timeAxis->intervalMinutes) {
+          openstudio::Time intervalTime(0, 0, *timeAxis->intervalMinutes, 0);
+          ts = openstudio::TimeSeries(timeAxis->firstReportDateTime, intervalTime, values, dataDictionary.units);
         } else {
-          // If Detailed, Timestep, RunPeriod, or Annual: it varies
-          intervalMinutes = sqlite3_column_int(sqlStmtPtr, b);  // Notice I'm not incrementing the counter here on purpose
-
-          if (reportingFrequency == ReportingFrequency::Annual) {
-            // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
-            // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
-            // cf https://github.com/NREL/EnergyPlus/issues/7939
-            if (intervalMinutes == 0) {
-              intervalMinutes = 365 * 24 * 60;
-            } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
-              // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
-              LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
-            }
+          ts = openstudio::TimeSeries(timeAxis->firstReportDateTime, timeAxis->secondsFromFirstReport, values, dataDictionary.units);
+        }
+      }
+    }
+
+    return ts;
+  }
+
+  std::shared_ptr<SqlFileTimeAxis> SqlFile_Impl::makeTimeAxis(const std::string& reportingFrequencyName, int envPeriodIndex,
+                                                              const std::vector<TimeRow>& timeRows) {
+    ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
+    bool isIntervalTimeSeries = false;
+    try {
+      reportingFrequency = ReportingFrequency(reportingFrequencyName);
+      isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) || (reportingFrequency == ReportingFrequency::Hourly)
+                             || (reportingFrequency == ReportingFrequency::Daily);
+
+    } catch (const std::exception&) {
+    }
+
+    std::string energyPlusVersion = this->energyPlusVersion();
+    VersionString version(energyPlusVersion);
+
+    auto timeAxis = std::make_shared<SqlFileTimeAxis>();
+    timeAxis->secondsFromFirstReport.reserve(timeRows.size());
+
+    boost::optional<openstudio::DateTime> firstReportDateTime;
+    boost::optional<unsigned> reportingIntervalMinutes;
+    boost::optional<unsigned> runPeriodIntervalMinutes;
+    long cumulativeSeconds = 0;
+
+    for (const TimeRow& timeRow : timeRows) {
+      boost::optional<unsigned> year = timeRow.year;
+      // As of EnergyPlus 9.4 and perhaps earlier, the anual run periods will have a valid year,
+      // however the sizing periods will have year = 0
+      if (year && (year.get() == 0)) {
+        year.reset();
+      }
+
+      unsigned month = timeRow.month;
+      unsigned day = timeRow.day;
+
+      // In cases where you report the same meter key for eg at Daily and at Timestep frequency
+      // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
+      // And since we can compute this easily, might as well do it
+      unsigned intervalMinutes;
+      if (reportingFrequency == ReportingFrequency::Hourly) {
+        intervalMinutes = 60;
+      } else if (reportingFrequency == ReportingFrequency::Daily) {
+        intervalMinutes = 24 * 60;
+      } else if (reportingFrequency == ReportingFrequency::Monthly) {
+        intervalMinutes = day * 24 * 60;
+      } else {
+        // If Detailed, Timestep, RunPeriod, or Annual: it varies
+        intervalMinutes = timeRow.intervalMinutes;
+
+        if (reportingFrequency == ReportingFrequency::Annual) {
+          // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
+          // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
+          // cf https://github.com/NREL/EnergyPlus/issues/7939
+          if (intervalMinutes == 0) {
+            intervalMinutes = 365 * 24 * 60;
+          } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
+            // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
+            LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
           }
         }
-        // Don't forget to increment the counter anyway, no matter whether we did call sqlite3_column_int or not
-        ++b;
-
-        if ((version.major() == 8) && (version.minor() == 3)) {
-          // workaround for bug in E+ 8.3, issue #1692
-          if (reportingFrequency == ReportingFrequency::RunPeriod) {
-            DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
-            DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
+      }
+
+      if ((version.major() == 8) && (version.minor() == 3)) {
+        // workaround for bug in E+ 8.3, issue #1692
+        if (reportingFrequency == ReportingFrequency::RunPeriod) {
+          if (!runPeriodIntervalMinutes) {
+            DateTime firstDateTime = this->firstDateTime(false, envPeriodIndex);
+            DateTime lastDateTime = this->lastDateTime(false, envPeriodIndex);
             Time deltaT = lastDateTime - firstDateTime;
-            intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
+            runPeriodIntervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
           }
+          intervalMinutes = *runPeriodIntervalMinutes;
         }
+      }
 
-        if (!firstReportDateTime) {
-          if ((month == 0) || (day == 0)) {
-            // gets called for RunPeriod reports
-            firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
+      if (!firstReportDateTime) {
+        if ((month == 0) || (day == 0)) {
+          // gets called for RunPeriod reports
+          firstReportDateTime = lastDateTime(false, envPeriodIndex);
+        } else {
+          // DLM: get standard time zone?
+          if (intervalMinutes >= 24 * 60) {
+            // Daily or Monthly
+            OS_ASSERT(intervalMinutes % (24 * 60) == 0);
+            firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
+                                       : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
           } else {
-            // DLM: get standard time zone?
-            if (intervalMinutes >= 24 * 60) {
-              // Daily or Monthly
-              OS_ASSERT(intervalMinutes % (24 * 60) == 0);
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
-            } else {
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
-            }
+            firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
+                                       : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
           }
         }
-
-        // Use the new way to create the time series with nonzero first entry
-        cumulativeSeconds += 60 * intervalMinutes;
-        stdSecondsFromFirstReport.push_back(cumulativeSeconds);
-
-        // check if this interval is same as the others
-        if (isIntervalTimeSeries && !reportingIntervalMinutes) {
-          reportingIntervalMinutes = intervalMinutes;
-        } else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)) {
-          isIntervalTimeSeries = false;
-          reportingIntervalMinutes.reset();
-        }
-
-        // step to next row
-        code = sqlite3_step(sqlStmtPtr);
       }
 
-      // must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
+      // Use the new way to create the time series with nonzero first entry
+      cumulativeSeconds += 60 * intervalMinutes;
+      timeAxis->secondsFromFirstReport.push_back(cumulativeSeconds);
 
-      if (firstReportDateTime && !stdSecondsFromFirstReport.empty()) {
-        if (isIntervalTimeSeries) {
-          openstudio::Time intervalTime(0, 0, *reportingIntervalMinutes, 0);
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
-        } else {
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, stdSecondsFromFirstReport, values, units);
-        }
+      // check if this interval is same as the others
+      if (isIntervalTimeSeries && !reportingIntervalMinutes) {
+        reportingIntervalMinutes = intervalMinutes;
+      } else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)) {
+        isIntervalTimeSeries = false;
+        reportingIntervalMinutes.reset();
       }
     }
 
-    return ts;
+    if (!firstReportDateTime || timeAxis->secondsFromFirstReport.empty()) {
+      return nullptr;
+    }
+    timeAxis->firstReportDateTime = *firstReportDateTime;
+    if (isIntervalTimeSeries) {
+      timeAxis->intervalMinutes = reportingIntervalMinutes;
+    }
+    return timeAxis;
   }
 
   openstudio::DateTimeVector SqlFile_Impl::dateTimeVec(const DataDictionaryItem& dataDictionary) {
@@ -3545,6 +3728,222 @@ namespace detail {
     return result;
   }
 
+  SqlFileTimeSeriesBlock SqlFile_Impl::timeSeriesBatch(const std::vector<SqlFileTimeSeriesQuery>& queries) {
+    SqlFileTimeSeriesBlock result;
+    if (!m_db) {
+      return result;
+    }
+
+    // resolve the queries to data dictionary items, in order and without duplicates
+    std::vector<const DataDictionaryItem*> items;
+    std::set<std::pair<int, int>> found;
+    for (const SqlFileTimeSeriesQuery& query : queries) {
+      SqlFileTimeSeriesQueryVector wqueries;
+      if (query.m_vetted) {
+        wqueries.push_back(query);
+      } else {
+        wqueries = expandQuery(query);
+      }
+      for (const SqlFileTimeSeriesQuery& wquery : wqueries) {
+        std::string envPeriod = boost::to_upper_copy(*(wquery.environment().get().name()));
+        std::string rf = wquery.reportingFrequency()->valueDescription();
+        std::string tsName = *(wquery.timeSeries().get().name());
+        std::vector<std::string> kvNames;
+        if (wquery.keyValues()) {
+          kvNames = wquery.keyValues().get().names();
+        } else {
+          kvNames = availableKeyValues(envPeriod, rf, tsName);
+        }
+        for (const std::string& kvName : kvNames) {
+          const DataDictionaryItem* item = findDataDictionaryItem(envPeriod, rf, tsName, kvName);
+          if (!item) {
+            LOG(Debug, "Tuple: " << envPeriod << ", " << rf << ", " << tsName << ", " << kvName << " not found in data dictionary.");
+          } else if (found.insert(std::make_pair(item->recordIndex, item->envPeriodIndex)).second) {
+            items.push_back(item);
+          }
+        }
+      }
+    }
+
+    // columns by data dictionary index and environment period, environment period by time index
+    std::vector<std::vector<std::pair<int, std::size_t>>> columnsByRecord;
+    std::vector<int> envPeriodByTimeIndex;
+    std::set<int> recordIndices;
+    std::set<int> envPeriodIndices;
+    for (std::size_t i = 0; i < items.size(); ++i) {
+      const DataDictionaryItem& item = *items[i];
+      if (item.recordIndex < 0) {
+        continue;
+      }
+      if (static_cast<std::size_t>(item.recordIndex) >= columnsByRecord.size()) {
+        columnsByRecord.resize(item.recordIndex + 1);
+      }
+      columnsByRecord[item.recordIndex].emplace_back(item.envPeriodIndex, i);
+      recordIndices.insert(item.recordIndex);
+      envPeriodIndices.insert(item.envPeriodIndex);
+    }
+    for (int envPeriodIndex : envPeriodIndices) {
+      for (const auto& timeRow : timeRows(envPeriodIndex)) {
+        if (timeRow.first < 0) {
+          continue;
+        }
+        if (static_cast<std::size_t>(timeRow.first) >= envPeriodByTimeIndex.size()) {
+          envPeriodByTimeIndex.resize(timeRow.first + 1, -1);
+        }
+        envPeriodByTimeIndex[timeRow.first] = envPeriodIndex;
+      }
+    }
+
+    // one scan of the report data for all the series. When most of the dictionary is requested,
+    // reading the whole table in storage order beats looking each series up in the index
+    std::vector<std::vector<double>> values(items.size());
+    std::vector<std::vector<int>> timeIndices(items.size());
+    if (!recordIndices.empty()) {
+      std::stringstream s;
+      s << "SELECT ReportDataDictionaryIndex, TimeIndex, Value FROM ReportData";
+      boost::optional<int> numRecords = execAndReturnFirstInt("SELECT COUNT(*) FROM ReportDataDictionary");
+      if (!numRecords || (4 * recordIndices.size() < static_cast<std::size_t>(*numRecords))) {
+        s << " WHERE ReportDataDictionaryIndex IN (";
+        for (auto it = recordIndices.begin(); it != recordIndices.end(); ++it) {
+          s << (it == recordIndices.begin() ? "" : ", ") << *it;
+        }
+        s << ")";
+      }
+
+      sqlite3_stmt* sqlStmtPtr;
+      int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+      if (code != SQLITE_OK) {
+        LOG(Error, "Error preparing statement: " << s.str() << ", " << sqlite3_errmsg(m_db));
+      } else {
+        // rows of each series come in ReportData order, which is time order
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+          int recordIndex = sqlite3_column_int(sqlStmtPtr, 0);
+          int timeIndex = sqlite3_column_int(sqlStmtPtr, 1);
+          if ((recordIndex < 0) || (static_cast<std::size_t>(recordIndex) >= columnsByRecord.size()) || (timeIndex < 0)
+              || (static_cast<std::size_t>(timeIndex) >= envPeriodByTimeIndex.size())) {
+            continue;
+          }
+          int envPeriodIndex = envPeriodByTimeIndex[timeIndex];
+          for (const auto& [columnEnvPeriodIndex, i] : columnsByRecord[recordIndex]) {
+            if (columnEnvPeriodIndex == envPeriodIndex) {
+              timeIndices[i].push_back(timeIndex);
+              values[i].push_back(sqlite3_column_double(sqlStmtPtr, 2));
+              break;
+            }
+          }
+        }
+      }
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
+    // assemble the block, sharing time axes between series reported at the same times
+    std::size_t totalSize = 0;
+    for (const std::vector<double>& columnValues : values) {
+      totalSize += columnValues.size();
+    }
+    result.m_values.reserve(totalSize);
+    for (std::size_t i = 0; i < items.size(); ++i) {
+      const DataDictionaryItem& item = *items[i];
+      if (values[i].empty()) {
+        continue;
+      }
+
+      std::shared_ptr<const SqlFileTimeAxis>& cachedTimeAxis = m_timeAxes[std::make_pair(item.envPeriodIndex, item.reportingFrequency)];
+      std::shared_ptr<const SqlFileTimeAxis> timeAxis;
+      if (cachedTimeAxis && (cachedTimeAxis->timeIndices == timeIndices[i])) {
+        timeAxis = cachedTimeAxis;
+      } else {
+        const std::unordered_map<int, TimeRow>& envPeriodTimeRows = timeRows(item.envPeriodIndex);
+        std::vector<TimeRow> columnTimeRows;
+        columnTimeRows.reserve(timeIndices[i].size());
+        for (int timeIndex : timeIndices[i]) {
+          columnTimeRows.push_back(envPeriodTimeRows.at(timeIndex));
+        }
+        std::shared_ptr<SqlFileTimeAxis> newTimeAxis = makeTimeAxis(item.reportingFrequency, item.envPeriodIndex, columnTimeRows);
+        if (!newTimeAxis) {
+          continue;
+        }
+        newTimeAxis->timeIndices = std::move(timeIndices[i]);
+        timeAxis = newTimeAxis;
+        if (!cachedTimeAxis) {
+          cachedTimeAxis = timeAxis;
+        }
+      }
+
+      SqlFileTimeSeriesBlock::Column column;
+      column.envPeriod = item.envPeriod;
+      column.reportingFrequency = item.reportingFrequency;
+      column.timeSeriesName = item.name;
+      column.keyValue = item.keyValue;
+      column.units = item.units;
+      column.offset = result.m_values.size();
+      column.size = values[i].size();
+      column.timeAxis = timeAxis;
+      result.m_values.insert(result.m_values.end(), values[i].begin(), values[i].end());
+      result.m_columns.push_back(std::move(column));
+    }
+
+    return result;
+  }
+
+  const DataDictionaryItem* SqlFile_Impl::findDataDictionaryItem(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                                 const std::string& timeSeriesName, const std::string& keyValue) {
+    const auto& index = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+    auto it = index.find(boost::make_tuple(envPeriod, reportingFrequency, timeSeriesName, keyValue));
+    if (it != index.end()) {
+      return &(*it);
+    }
+
+    const DataDictionaryItem* result = nullptr;
+    std::string upperKeyValue = boost::to_upper_copy(keyValue);
+    if (upperKeyValue != keyValue) {
+      result = findDataDictionaryItem(envPeriod, reportingFrequency, timeSeriesName, upperKeyValue);
+    }
+    if (!result && (istringEqual("Annual", reportingFrequency) || istringEqual("Environment", reportingFrequency))) {
+      result = findDataDictionaryItem(envPeriod, "Run Period", timeSeriesName, keyValue);
+    }
+    if (!result) {
+      openstudio::OptionalReportingFrequency freq = reportingFrequencyFromDB(reportingFrequency);
+      if (freq && (reportingFrequency != freq->valueDescription())) {
+        result = findDataDictionaryItem(envPeriod, freq->valueDescription(), timeSeriesName, keyValue);
+      }
+    }
+    return result;
+  }
+
+  const std::unordered_map<int, SqlFile_Impl::TimeRow>& SqlFile_Impl::timeRows(int envPeriodIndex) {
+    auto it = m_timeRows.find(envPeriodIndex);
+    if (it != m_timeRows.end()) {
+      return it->second;
+    }
+
+    std::unordered_map<int, TimeRow>& result = m_timeRows[envPeriodIndex];
+    std::stringstream s;
+    s << "SELECT TimeIndex, ";
+    if (hasYear()) {
+      s << "Year, ";
+    }
+    s << "Month, Day, Interval FROM Time WHERE EnvironmentPeriodIndex = " << envPeriodIndex;
+
+    sqlite3_stmt* sqlStmtPtr;
+    sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+      int b = 0;
+      int timeIndex = sqlite3_column_int(sqlStmtPtr, b++);
+      TimeRow timeRow;
+      if (hasYear()) {
+        timeRow.year = sqlite3_column_int(sqlStmtPtr, b++);
+      }
+      timeRow.month = sqlite3_column_int(sqlStmtPtr, b++);
+      timeRow.day = sqlite3_column_int(sqlStmtPtr, b++);
+      timeRow.intervalMinutes = sqlite3_column_int(sqlStmtPtr, b++);
+      result.emplace(timeIndex, timeRow);
+    }
+    sqlite3_finalize(sqlStmtPtr);
+
+    return result;
+  }
+
   boost::optional<std::pair<DateTime, DateTime>> SqlFile_Impl::daylightSavingsPeriod() const {
     // first and last date for dst=1
     // sqlite3 does not have interface for first and last record in recordset
@@ -3638,6 +4037,108 @@ namespace detail {
     return result;
   }
 
+  boost::optional<double> SqlFile_Impl::componentSizeValue(const std::string& compType, const std::string& compName,
+                                                           const std::string& description, const std::string& units) const {
+    const auto& sizes = componentSizes();
+    auto it = sizes.find(ComponentSizesKey(compType, compName, description, units));
+    if (it != sizes.end()) {
+      return it->second;
+    }
+    return boost::none;
+  }
+
+  boost::optional<double> SqlFile_Impl::componentSizingInformationValue(const std::string& compName, const std::string& description) const {
+    const ComponentSizingInformation& info = componentSizingInformation();
+    auto rowNames = info.rowNamesByValue.find(compName);
+    if (rowNames == info.rowNamesByValue.end()) {
+      return boost::none;
+    }
+    for (const std::string& rowName : rowNames->second) {
+      auto values = info.valuesByRowName.find(rowName);
+      if ((values == info.valuesByRowName.end()) || (values->second.count(description) == 0)) {
+        continue;
+      }
+      auto value = info.valueColumnByRowName.find(rowName);
+      if (value != info.valueColumnByRowName.end()) {
+        return value->second;
+      }
+    }
+    return boost::none;
+  }
+
+  std::size_t SqlFile_Impl::ComponentSizesKeyHash::operator()(const ComponentSizesKey& key) const {
+    std::size_t result = 0;
+    boost::hash_combine(result, std::get<0>(key));
+    boost::hash_combine(result, std::get<1>(key));
+    boost::hash_combine(result, std::get<2>(key));
+    boost::hash_combine(result, std::get<3>(key));
+    return result;
+  }
+
+  const std::unordered_map<SqlFile_Impl::ComponentSizesKey, double, SqlFile_Impl::ComponentSizesKeyHash>& SqlFile_Impl::componentSizes() const {
+    if (m_componentSizes) {
+      return *m_componentSizes;
+    }
+
+    m_componentSizes.emplace();
+    if (m_db) {
+      sqlite3_stmt* sqlStmtPtr;
+      sqlite3_prepare_v2(m_db, "SELECT CompType, CompName, Description, Units, Value FROM ComponentSizes", -1, &sqlStmtPtr, nullptr);
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        // rows with a NULL field can never be matched by a lookup
+        const unsigned char* compType = sqlite3_column_text(sqlStmtPtr, 0);
+        const unsigned char* compName = sqlite3_column_text(sqlStmtPtr, 1);
+        const unsigned char* description = sqlite3_column_text(sqlStmtPtr, 2);
+        const unsigned char* units = sqlite3_column_text(sqlStmtPtr, 3);
+        if (!compType || !compName || !description || !units) {
+          continue;
+        }
+        // keep the first row for each key, like a direct query would
+        m_componentSizes->emplace(ComponentSizesKey(columnText(compType), columnText(compName), columnText(description), columnText(units)),
+                                  sqlite3_column_double(sqlStmtPtr, 4));
+      }
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
+    return *m_componentSizes;
+  }
+
+  const SqlFile_Impl::ComponentSizingInformation& SqlFile_Impl::componentSizingInformation() const {
+    if (m_componentSizingInformation) {
+      return *m_componentSizingInformation;
+    }
+
+    m_componentSizingInformation.emplace();
+    if (m_db) {
+      ComponentSizingInformation& info = *m_componentSizingInformation;
+      sqlite3_stmt* sqlStmtPtr;
+      sqlite3_prepare_v2(m_db,
+                         "SELECT RowName, ColumnName, Value FROM TabularDataWithStrings WHERE ReportName = 'InitializationSummary' AND "
+                         "ReportForString = 'Entire Facility' AND TableName = 'Component Sizing Information'",
+                         -1, &sqlStmtPtr, nullptr);
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        const unsigned char* rowName = sqlite3_column_text(sqlStmtPtr, 0);
+        const unsigned char* columnName = sqlite3_column_text(sqlStmtPtr, 1);
+        const unsigned char* value = sqlite3_column_text(sqlStmtPtr, 2);
+        if (!rowName || !value) {
+          continue;
+        }
+        std::string row = columnText(rowName);
+        std::string valueText = columnText(value);
+        if (info.valuesByRowName[row].insert(valueText).second) {
+          info.rowNamesByValue[valueText].push_back(row);
+        }
+        if (columnName && (columnText(columnName) == "Value")) {
+          // converted the same way sqlite converts the text when asked for a double
+          info.valueColumnByRowName.emplace(row, sqlite3_column_double(sqlStmtPtr, 2));
+        }
+      }
+      sqlite3_finalize(sqlStmtPtr);
+    }
+
+    return *m_componentSizingInformation;
+  }
+
   /// Energy Plus eplusout.sql file name
   std::string SqlFile_Impl::energyPlusSqliteFile() const {
     return m_sqliteFilename;
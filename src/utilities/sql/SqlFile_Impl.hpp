@@ -11,6 +11,7 @@
 #include "SummaryData.hpp"
 #include "SqlFileEnums.hpp"
 #include "SqlFileDataDictionary.hpp"
+#include "SqlFileTimeSeriesBlock.hpp"
 #include "PreparedStatement.hpp"
 #include "../data/DataEnums.hpp"
 #include "../data/EndUses.hpp"
@@ -21,7 +22,13 @@
 
 #include <boost/optional.hpp>
 
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 struct sqlite3;
@@ -44,7 +51,8 @@ namespace detail {
     /// or if file is not valid
     /// createIndexes will create useful indexes when opening an sqlite file but for faster opening
     /// pass in false if those indexes are not needed
-    SqlFile_Impl(const openstudio::path& path, const bool createIndexes = true);
+    /// readOnly opens the file read-only, tuned for querying, and never creates indexes
+    SqlFile_Impl(const openstudio::path& path, const bool createIndexes = true, const bool readOnly = false);
 
     /// createIndexes will create useful indexes when creating an sqlite file but for faster creation
     /// pass in false if those indexes are not needed
@@ -66,6 +74,9 @@ namespace detail {
     /// get the path
     openstudio::path path() const;
 
+    /// returns true if the file was opened read-only
+    bool readOnly() const;
+
     /// close the file
     bool close();
 
@@ -1091,6 +1102,10 @@ namespace detail {
        *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
     std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+    /** Executes all queries together, with one scan of the report data per environment period. Time
+       *  axes are shared between series, and cached for later calls. */
+    SqlFileTimeSeriesBlock timeSeriesBatch(const std::vector<SqlFileTimeSeriesQuery>& queries);
+
     // returns an optional pair of date times for begin and end of daylight savings time
     boost::optional<std::pair<openstudio::DateTime, openstudio::DateTime>> daylightSavingsPeriod() const;
 
@@ -1101,6 +1116,13 @@ namespace detail {
     // DLM@20100511: can we query this?
     std::string energyPlusVersion() const;
 
+    /// Value of the ComponentSizes row matching the tuple, from the in-memory index
+    boost::optional<double> componentSizeValue(const std::string& compType, const std::string& compName, const std::string& description,
+                                               const std::string& units) const;
+
+    /// 'Value' of the first Component Sizing Information row containing compName and description, from the in-memory index
+    boost::optional<double> componentSizingInformationValue(const std::string& compName, const std::string& description) const;
+
     /// Energy Plus eplusout.sql file name
     std::string energyPlusSqliteFile() const;
 
@@ -1178,8 +1200,8 @@ namespace detail {
     template <typename... Args>
     boost::optional<double> execAndReturnFirstDouble(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnFirstDouble();
+        std::shared_ptr<PreparedStatement> stmt = cachedStatement(statement, args...);
+        return stmt->execAndReturnFirstDouble();
       }
       return boost::none;
     }
@@ -1189,8 +1211,8 @@ namespace detail {
     template <typename... Args>
     boost::optional<int> execAndReturnFirstInt(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnFirstInt();
+        std::shared_ptr<PreparedStatement> stmt = cachedStatement(statement, args...);
+        return stmt->execAndReturnFirstInt();
       }
       return boost::none;
     }
@@ -1200,8 +1222,8 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::string> execAndReturnFirstString(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnFirstString();
+        std::shared_ptr<PreparedStatement> stmt = cachedStatement(statement, args...);
+        return stmt->execAndReturnFirstString();
       }
       return boost::none;
     }
@@ -1211,8 +1233,8 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<double>> execAndReturnVectorOfDouble(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnVectorOfDouble();
+        std::shared_ptr<PreparedStatement> stmt = cachedStatement(statement, args...);
+        return stmt->execAndReturnVectorOfDouble();
       }
       return boost::none;
     }
@@ -1222,8 +1244,8 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<int>> execAndReturnVectorOfInt(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnVectorOfInt();
+        std::shared_ptr<PreparedStatement> stmt = cachedStatement(statement, args...);
+        return stmt->execAndReturnVectorOfInt();
       }
       return boost::none;
     }
@@ -1233,8 +1255,8 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<std::string>> execAndReturnVectorOfString(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnVectorOfString();
+        std::shared_ptr<PreparedStatement> stmt = cachedStatement(statement, args...);
+        return stmt->execAndReturnVectorOfString();
       }
       return boost::none;
     }
@@ -1247,8 +1269,8 @@ namespace detail {
       constexpr auto SQLITE_ERROR = 1;
       auto code = SQLITE_ERROR;
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        code = stmt.execute();
+        std::shared_ptr<PreparedStatement> stmt = cachedStatement(statement, args...);
+        code = stmt->execute();
       }
       return code;
     }
@@ -1263,6 +1285,18 @@ namespace detail {
                               const openstudio::ReportingFrequency& t_reportingFrequency, const boost::optional<std::string>& t_scheduleName,
                               const std::string& t_variableUnits, const openstudio::TimeSeries& t_timeSeries);
 
+    void insertTimeSeriesData(const std::string& t_variableType, const std::string& t_indexGroup, const std::string& t_timestepType,
+                              const std::string& t_keyValue, const std::string& t_variableName,
+                              const openstudio::ReportingFrequency& t_reportingFrequency, const boost::optional<std::string>& t_scheduleName,
+                              const std::string& t_variableUnits, const openstudio::DateTime& t_firstReportDateTime,
+                              const openstudio::Time& t_intervalLength, const std::vector<double>& t_values);
+
+    void beginInsertBatch(bool disableJournal);
+
+    void commitInsertBatch();
+
+    bool isInsertBatchOpen() const;
+
     int insertZone(const std::string& t_name, double t_relNorth, double t_originX, double t_originY, double t_originZ, double t_centroidX,
                    double t_centroidY, double t_centroidZ, int t_ofType, double t_multiplier, double t_listMultiplier, double t_minimumX,
                    double t_maximumX, double t_minimumY, double t_maximumY, double t_minimumZ, double t_maximumZ, double t_ceilingHeight,
@@ -1309,13 +1343,60 @@ namespace detail {
       if (!m_connectionOpen) {
         throw std::runtime_error("Error executing SQL statement as database connection is not open.");
       }
-      PreparedStatement stmt(bindingStatement, m_db, false, args...);
-      stmt.execAndThrowOnError();
+      std::shared_ptr<PreparedStatement> stmt = cachedStatement(bindingStatement, args...);
+      stmt->execAndThrowOnError();
+    }
+
+    // returns the cached statement for statement, reset and with args bound
+    template <typename... Args>
+    std::shared_ptr<PreparedStatement> cachedStatement(const std::string& statement, Args&&... args) const {
+      std::shared_ptr<PreparedStatement> stmt = m_statementCache.get(statement, m_db);
+      if (!stmt->bindAll(args...)) {
+        throw std::runtime_error("Error bindings args with statement: " + statement);
+      }
+      return stmt;
     }
 
+    // returns true if the connection can write to the file
+    bool isWritable() const;
+
     void addSimulation(const openstudio::EpwFile& t_epwFile, const openstudio::DateTime& t_simulationTime, const openstudio::Calendar& t_calendar);
     int getNextIndex(const std::string& t_tableName, const std::string& t_columnName);
 
+    // insert the ReportDataDictionary row of a new report variable, returns its index
+    int insertReportDataDictionary(const std::string& t_variableType, const std::string& t_indexGroup, const std::string& t_timestepType,
+                                   const std::string& t_keyValue, const std::string& t_variableName,
+                                   const openstudio::ReportingFrequency& t_reportingFrequency, const boost::optional<std::string>& t_scheduleName,
+                                   const std::string& t_variableUnits);
+
+    // insert one ReportData row per value, t_values[i] is reported at t_dateTimes[i]
+    void insertReportData(int t_dataDictionaryIndex, const std::vector<openstudio::DateTime>& t_dateTimes, const std::vector<double>& t_values);
+
+    // return the TimeIndex of the first row of the Time table for each (Year, Month, Day, Hour, Minute), see reportTimeKey
+    const std::unordered_map<std::int64_t, int>& timeIndexByReportTime();
+
+    // key of timeIndexByReportTime, year is ignored if the Time table has no Year column
+    std::int64_t reportTimeKey(int year, int month, int day, int hour, int minute) const;
+
+    // fields of a Time table row used to place a report on a time axis
+    struct TimeRow
+    {
+      boost::optional<unsigned> year;
+      unsigned month;
+      unsigned day;
+      unsigned intervalMinutes;
+    };
+
+    // return the data dictionary item matching the tuple, trying the same alternatives as timeSeries(envPeriod, ...)
+    const DataDictionaryItem* findDataDictionaryItem(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                     const std::string& timeSeriesName, const std::string& keyValue);
+
+    // return the time axis of a series reported at reportingFrequency, given its rows of the Time table, or nullptr if it has none
+    std::shared_ptr<SqlFileTimeAxis> makeTimeAxis(const std::string& reportingFrequency, int envPeriodIndex, const std::vector<TimeRow>& timeRows);
+
+    // return the rows of the Time table for envPeriodIndex, by TimeIndex
+    const std::unordered_map<int, TimeRow>& timeRows(int envPeriodIndex);
+
     // return a single timeseries matching recordIndex - internally used to retrieve timeseries
     boost::optional<TimeSeries> timeSeries(const DataDictionaryItem& dataDictionary);
     std::vector<double> timeSeriesValues(const DataDictionaryItem& dataDictionary);
@@ -1334,14 +1415,54 @@ namespace detail {
 
     bool isValidConnection();
 
+    // CompType, CompName, Description, Units
+    using ComponentSizesKey = std::tuple<std::string, std::string, std::string, std::string>;
+
+    struct ComponentSizesKeyHash
+    {
+      std::size_t operator()(const ComponentSizesKey& key) const;
+    };
+
+    // Component Sizing Information table of the InitializationSummary report
+    struct ComponentSizingInformation
+    {
+      // names of the rows that contain each value, in table order
+      std::unordered_map<std::string, std::vector<std::string>> rowNamesByValue;
+      // values contained in each row
+      std::unordered_map<std::string, std::unordered_set<std::string>> valuesByRowName;
+      // 'Value' column of each row
+      std::unordered_map<std::string, double> valueColumnByRowName;
+    };
+
+    // read the ComponentSizes table, if not done already
+    const std::unordered_map<ComponentSizesKey, double, ComponentSizesKeyHash>& componentSizes() const;
+
+    // read the Component Sizing Information table, if not done already
+    const ComponentSizingInformation& componentSizingInformation() const;
+
     void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
     openstudio::path m_path;
     bool m_connectionOpen;
     DataDictionaryTable m_dataDictionary;
+    // caches for timeSeriesBatch, the Time table is not modified once the file is created
+    std::map<int, std::unordered_map<int, TimeRow>> m_timeRows;
+    std::map<std::pair<int, std::string>, std::shared_ptr<const SqlFileTimeAxis>> m_timeAxes;
+    // sizing tables loaded on first use by the autosized value lookups, cleared when the file is closed
+    mutable boost::optional<std::unordered_map<ComponentSizesKey, double, ComponentSizesKeyHash>> m_componentSizes;
+    mutable boost::optional<ComponentSizingInformation> m_componentSizingInformation;
     sqlite3* m_db;
+    // statements used by the exec* helpers, must be cleared before m_db is closed
+    mutable PreparedStatementCache m_statementCache;
+    // depth of nested insert batches, and statements restoring the pragmas changed by the outermost batch
+    unsigned m_insertBatchDepth = 0;
+    std::vector<std::string> m_restorePragmasAfterInsertBatch;
+    // TimeIndex lookup used by insertTimeSeriesData, only kept while an insert batch is open
+    boost::optional<std::unordered_map<std::int64_t, int>> m_timeIndexByReportTime;
     std::string m_sqliteFilename;
 
+    bool m_readOnly;
+
     bool m_supportedVersion;
 
     bool m_hasYear;
@@ -7,6 +7,8 @@
 
 #include "SqlFileFixture.hpp"
 
+#include "../SqlFileTimeSeriesQuery.hpp"
+
 #include "../../time/Date.hpp"
 #include "../../time/Calendar.hpp"
 #include "../../core/Optional.hpp"
@@ -197,6 +199,53 @@ TEST_F(SqlFileFixture, TimeSeries) {
   EXPECT_DOUBLE_EQ(365 - 1.0 / 24.0, duration.totalDays());
 }
 
+TEST_F(SqlFileFixture, TimeSeriesBatch) {
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  const std::string& envPeriod = availableEnvPeriods[0];
+
+  std::vector<SqlFileTimeSeriesQuery> queries;
+  queries.emplace_back(envPeriod, ReportingFrequency(ReportingFrequency::Hourly), "Site Outdoor Air Drybulb Temperature", "Environment");
+  queries.emplace_back(envPeriod, ReportingFrequency(ReportingFrequency::Detailed), "Site Outdoor Air Drybulb Temperature", "Environment");
+  queries.emplace_back(envPeriod, ReportingFrequency(ReportingFrequency::Hourly), "Electricity:Facility", "");
+  queries.emplace_back(envPeriod, ReportingFrequency(ReportingFrequency::Hourly), "NaturalGas:Facility", "");
+  // duplicates and missing series are dropped
+  queries.emplace_back(envPeriod, ReportingFrequency(ReportingFrequency::Hourly), "Electricity:Facility", "");
+  queries.emplace_back(envPeriod, ReportingFrequency(ReportingFrequency::Hourly), "NotAVariable:Facility", "");
+
+  SqlFileTimeSeriesBlock block = sqlFile.timeSeriesBatch(queries);
+  ASSERT_EQ(4u, block.numColumns());
+
+  for (unsigned i = 0; i < block.numColumns(); ++i) {
+    openstudio::OptionalTimeSeries ts = sqlFile.timeSeries(envPeriod, block.reportingFrequency(i), block.timeSeriesName(i), block.keyValue(i));
+    ASSERT_TRUE(ts);
+    TimeSeries batchTs = block.timeSeries(i);
+    ASSERT_EQ(ts->values().size(), block.size(i));
+    EXPECT_EQ(openstudio::toStandardVector(ts->values()), block.values(i));
+    EXPECT_EQ(openstudio::toStandardVector(ts->values()), openstudio::toStandardVector(batchTs.values()));
+    EXPECT_EQ(openstudio::toStandardVector(ts->daysFromFirstReport()), openstudio::toStandardVector(batchTs.daysFromFirstReport()));
+    EXPECT_EQ(ts->firstReportDateTime(), block.firstReportDateTime(i));
+    EXPECT_TRUE(ts->intervalLength() == block.intervalLength(i));
+    EXPECT_EQ(ts->units(), block.units(i));
+  }
+
+  boost::optional<unsigned> hourlyOat = block.findColumn(block.environmentPeriod(0), "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment");
+  boost::optional<unsigned> hourlyElectricity = block.findColumn(block.environmentPeriod(0), "Hourly", "Electricity:Facility", "");
+  ASSERT_TRUE(hourlyOat);
+  ASSERT_TRUE(hourlyElectricity);
+  EXPECT_EQ(8760u, block.size(*hourlyOat));
+  EXPECT_DOUBLE_EQ(-8.2625, block.data(*hourlyOat)[0]);
+  EXPECT_TRUE(block.sharesTimeAxis(*hourlyOat, *hourlyElectricity));
+  EXPECT_FALSE(block.findColumn(block.environmentPeriod(0), "Hourly", "NotAVariable:Facility", ""));
+
+  // the time axes are cached on the SqlFile
+  SqlFileTimeSeriesBlock block2 = sqlFile.timeSeriesBatch({queries[0]});
+  ASSERT_EQ(1u, block2.numColumns());
+  EXPECT_EQ(block.values(0), block2.values(0));
+
+  EXPECT_THROW(block.size(4), std::out_of_range);
+}
+
 TEST_F(SqlFileFixture, BadStatement) {
   const std::string query = "SELECT * FROM NonExistantTable;";
   try {
@@ -293,6 +342,194 @@ TEST_F(SqlFileFixture, CreateSqlFile) {
   }
 }
 
+TEST_F(SqlFileFixture, ReadOnly) {
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileReadOnlyTest.sql");
+  if (openstudio::filesystem::exists(outfile)) {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+  std::vector<double> values{100, 10, 1, 100.5};
+  TimeSeries timeSeries(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(values), "lux");
+
+  {
+    openstudio::SqlFile sql(outfile, openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+                            openstudio::DateTime::now(), c, false);
+    ASSERT_TRUE(sql.connectionOpen());
+    EXPECT_FALSE(sql.readOnly());
+    sql.insertTimeSeriesData("Sum", "Zone", "Zone", "DAYLIGHTING WINDOW", "Daylight Luminance", openstudio::ReportingFrequency::Hourly,
+                             boost::optional<std::string>(), "lux", timeSeries);
+  }
+
+  const std::string countIndexes = "SELECT COUNT(*) FROM sqlite_master WHERE type = 'index' AND name = ?";
+
+  {
+    openstudio::SqlFile sql(outfile, true, true);
+    ASSERT_TRUE(sql.connectionOpen());
+    EXPECT_TRUE(sql.readOnly());
+
+    // indexes are not created on a read-only connection
+    EXPECT_EQ(0, sql.execAndReturnFirstInt(countIndexes, "rdDI").get());
+
+    // statements are prepared once and rebound on every call
+    for (int i = 1; i <= 3; ++i) {
+      EXPECT_EQ(i, sql.execAndReturnFirstInt("SELECT ?", i).get());
+      EXPECT_DOUBLE_EQ(values[i], sql.execAndReturnFirstDouble("SELECT Value FROM ReportData WHERE ReportDataIndex = ?", i + 1).get());
+    }
+
+    std::vector<std::string> envPeriods = sql.availableEnvPeriods();
+    ASSERT_EQ(1u, envPeriods.size());
+    boost::optional<TimeSeries> ts = sql.timeSeries(envPeriods[0], "Hourly", "Daylight Luminance", "DAYLIGHTING WINDOW");
+    ASSERT_TRUE(ts);
+    EXPECT_EQ(values, openstudio::toStandardVector(ts->values()));
+
+    EXPECT_ANY_THROW(sql.insertZone("CLASSROOM", 0, 0, 0, 0, 1, 1, 1, 3, 1, 1, 0, 2, 0, 2, 0, 2, 2, 8, 3, 3, 4, 4, 2, 2, true));
+
+    EXPECT_TRUE(sql.close());
+    EXPECT_TRUE(sql.reopen());
+    EXPECT_TRUE(sql.readOnly());
+    EXPECT_EQ(1, sql.execAndReturnFirstInt("SELECT ?", 1).get());
+  }
+
+  {
+    openstudio::SqlFile sql(outfile);
+    ASSERT_TRUE(sql.connectionOpen());
+    EXPECT_FALSE(sql.readOnly());
+    EXPECT_EQ(1, sql.execAndReturnFirstInt(countIndexes, "rdDI").get());
+
+    // cached statements do not keep the connection from changing the schema
+    EXPECT_TRUE(sql.execAndReturnFirstInt("SELECT COUNT(*) FROM Zones WHERE ZoneIndex >= ?", 0));
+    sql.removeIndexes();
+    EXPECT_EQ(0, sql.execAndReturnFirstInt(countIndexes, "rdDI").get());
+    sql.createIndexes();
+    EXPECT_EQ(1, sql.execAndReturnFirstInt(countIndexes, "rdDI").get());
+  }
+}
+
+TEST_F(SqlFileFixture, InsertBatch) {
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileInsertBatch.sql");
+  if (openstudio::filesystem::exists(outfile)) {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+
+  // one value per hour of the year, except for the last one which would be reported at midnight of the next year
+  std::vector<std::vector<double>> allValues;
+  for (int i = 0; i < 100; ++i) {
+    std::vector<double> values(8783);
+    for (unsigned j = 0; j < values.size(); ++j) {
+      values[j] = i + j * 0.5;
+    }
+    allValues.push_back(values);
+  }
+
+  {
+    openstudio::SqlFile sql(outfile, openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+                            openstudio::DateTime::now(), c);
+    ASSERT_TRUE(sql.connectionOpen());
+    EXPECT_FALSE(sql.isInsertBatchOpen());
+
+    {
+      SqlFile::InsertBatch batch(sql, true);
+      EXPECT_TRUE(sql.isInsertBatchOpen());
+      for (int i = 0; i < 100; ++i) {
+        std::string keyValue = "ZONE " + std::to_string(i);
+        TimeSeries timeSeries(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(allValues[i]), "W");
+        if (i % 2 == 0) {
+          sql.insertTimeSeriesData("Sum", "Zone", "Zone", keyValue, "Zone Lights Electricity Rate", openstudio::ReportingFrequency::Hourly,
+                                   boost::none, "W", timeSeries);
+        } else {
+          sql.insertTimeSeriesData("Sum", "Zone", "Zone", keyValue, "Zone Lights Electricity Rate", openstudio::ReportingFrequency::Hourly,
+                                   boost::none, "W", timeSeries.firstReportDateTime(), openstudio::Time(0, 1), allValues[i]);
+        }
+      }
+
+      // batches nest
+      sql.beginInsertBatch();
+      sql.commitInsertBatch();
+      EXPECT_TRUE(sql.isInsertBatchOpen());
+    }
+    EXPECT_FALSE(sql.isInsertBatchOpen());
+  }
+
+  {
+    openstudio::SqlFile sql(outfile);
+    ASSERT_TRUE(sql.connectionOpen());
+    std::vector<std::string> envPeriods = sql.availableEnvPeriods();
+    ASSERT_EQ(1u, envPeriods.size());
+    EXPECT_EQ(100u, sql.availableKeyValues(envPeriods[0], "Hourly", "Zone Lights Electricity Rate").size());
+
+    // both overloads write the same report times
+    boost::optional<TimeSeries> ts0 = sql.timeSeries(envPeriods[0], "Hourly", "Zone Lights Electricity Rate", "ZONE 0");
+    ASSERT_TRUE(ts0);
+    for (int i : {0, 1, 98, 99}) {
+      std::string keyValue = "ZONE " + std::to_string(i);
+      boost::optional<TimeSeries> ts = sql.timeSeries(envPeriods[0], "Hourly", "Zone Lights Electricity Rate", keyValue);
+      ASSERT_TRUE(ts) << keyValue;
+      EXPECT_EQ(allValues[i], openstudio::toStandardVector(ts->values()));
+      EXPECT_EQ(ts0->firstReportDateTime(), ts->firstReportDateTime());
+      EXPECT_EQ(openstudio::toStandardVector(ts0->daysFromFirstReport()), openstudio::toStandardVector(ts->daysFromFirstReport()));
+    }
+  }
+}
+
+TEST_F(SqlFileFixture, ComponentSizeValues) {
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileComponentSizesTest.sql");
+  if (openstudio::filesystem::exists(outfile)) {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+  openstudio::SqlFile sql(outfile, openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+                          openstudio::DateTime::now(), c);
+  ASSERT_TRUE(sql.connectionOpen());
+
+  const std::string insertSize = "INSERT INTO ComponentSizes (CompType, CompName, Description, Value, Units) VALUES (?, ?, ?, ?, ?)";
+  sql.execute(insertSize, "Coil:Heating:Electric", "COIL 1", "Design Size Nominal Capacity", 1234.5, "W");
+  sql.execute(insertSize, "Coil:Heating:Electric", "COIL 1", "Design Size Nominal Capacity", 1.0, "W");
+  sql.execute(insertSize, "Fan:ConstantVolume", "FAN 1", "Design Size Maximum Flow Rate", 2.5, "m3/s");
+
+  const std::vector<std::string> strings{"InitializationSummary", "Entire Facility", "Component Sizing Information", "1", "2", "Component Type",
+                                         "Component Name", "Input Field Description", "Value", ""};
+  for (unsigned i = 0; i < strings.size(); ++i) {
+    sql.execute("INSERT INTO Strings (StringIndex, StringTypeIndex, Value) VALUES (?, 1, ?)", int(i + 1), strings[i]);
+  }
+  // rows '1' and '2' of the Component Sizing Information table, both for COIL 1
+  const std::string insertCell =
+    "INSERT INTO TabularData (ReportNameIndex, ReportForStringIndex, TableNameIndex, RowNameIndex, ColumnNameIndex, UnitsIndex, SimulationIndex, "
+    "RowId, ColumnId, Value) VALUES (1, 2, 3, ?, ?, 10, 1, ?, ?, ?)";
+  sql.execute(insertCell, 4, 6, 1, 1, "Coil:Heating:Electric");
+  sql.execute(insertCell, 4, 7, 1, 2, "COIL 1");
+  sql.execute(insertCell, 4, 8, 1, 3, "Design Size Nominal Capacity [W]");
+  sql.execute(insertCell, 4, 9, 1, 4, "1234.5");
+  sql.execute(insertCell, 5, 6, 2, 1, "Coil:Heating:Electric");
+  sql.execute(insertCell, 5, 7, 2, 2, "COIL 1");
+  sql.execute(insertCell, 5, 8, 2, 3, "Design Size Heating Design Capacity [W]");
+  sql.execute(insertCell, 5, 9, 2, 4, "42");
+
+  // the first matching row wins, as with a direct query
+  ASSERT_TRUE(sql.componentSizeValue("Coil:Heating:Electric", "COIL 1", "Design Size Nominal Capacity", "W"));
+  EXPECT_DOUBLE_EQ(1234.5, sql.componentSizeValue("Coil:Heating:Electric", "COIL 1", "Design Size Nominal Capacity", "W").get());
+  ASSERT_TRUE(sql.componentSizeValue("Fan:ConstantVolume", "FAN 1", "Design Size Maximum Flow Rate", "m3/s"));
+  EXPECT_DOUBLE_EQ(2.5, sql.componentSizeValue("Fan:ConstantVolume", "FAN 1", "Design Size Maximum Flow Rate", "m3/s").get());
+  EXPECT_FALSE(sql.componentSizeValue("Fan:ConstantVolume", "FAN 1", "Design Size Maximum Flow Rate", "cfm"));
+  EXPECT_FALSE(sql.componentSizeValue("Fan:ConstantVolume", "Fan 1", "Design Size Maximum Flow Rate", "m3/s"));
+
+  ASSERT_TRUE(sql.componentSizingInformationValue("COIL 1", "Design Size Nominal Capacity [W]"));
+  EXPECT_DOUBLE_EQ(1234.5, sql.componentSizingInformationValue("COIL 1", "Design Size Nominal Capacity [W]").get());
+  ASSERT_TRUE(sql.componentSizingInformationValue("COIL 1", "Design Size Heating Design Capacity [W]"));
+  EXPECT_DOUBLE_EQ(42.0, sql.componentSizingInformationValue("COIL 1", "Design Size Heating Design Capacity [W]").get());
+  EXPECT_FALSE(sql.componentSizingInformationValue("COIL 2", "Design Size Nominal Capacity [W]"));
+  EXPECT_FALSE(sql.componentSizingInformationValue("COIL 1", "Design Size Nominal Capacity"));
+
+  // the index is loaded once, and dropped when the file is reopened
+  sql.execute("UPDATE ComponentSizes SET Value = 3.0 WHERE CompName = 'FAN 1'");
+  EXPECT_DOUBLE_EQ(2.5, sql.componentSizeValue("Fan:ConstantVolume", "FAN 1", "Design Size Maximum Flow Rate", "m3/s").get());
+  EXPECT_TRUE(sql.reopen());
+  EXPECT_DOUBLE_EQ(3.0, sql.componentSizeValue("Fan:ConstantVolume", "FAN 1", "Design Size Maximum Flow Rate", "m3/s").get());
+}
+
 TEST_F(SqlFileFixture, AnnualTotalCosts) {
 
   struct SqlResults